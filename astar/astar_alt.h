@@ -0,0 +1,467 @@
+//ALT / Landmark A*: precomputes distances to a landmark L and sets h(s)=|d(L,s)−d(L,goal)|,
+// a triangle-inequality heuristic that tightens estimates without losing admissibility.
+#ifndef ASTAR_ALT_H
+#define ASTAR_ALT_H
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/parallel.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../dijkstra/dijk_delta.h"
+#include <vector>
+#include <queue>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+//plain Dijkstra (lazy heap) – used for preprocessing
+template <typename GraphT>
+std::vector<double> dijkstra(const GraphT &G, int s)
+{
+    int n = G.size();
+    std::vector<double> d(n, INF);
+    std::vector<char> vis(n, 0);
+    using P = std::pair<double, int>;
+    std::priority_queue<P, std::vector<P>, std::greater<P>> pq;
+
+    d[s] = 0;
+    pq.emplace(0, s);
+
+    while (!pq.empty())
+    {
+        auto [dist, u] = pq.top();
+        pq.pop();
+        if (vis[u])
+            continue;
+        vis[u] = 1;
+
+        for (auto [v, w] : G[u])
+            if (!vis[v] && dist + w < d[v])
+            {
+                d[v] = dist + w;
+                pq.emplace(d[v], v);
+            }
+    }
+    return d;
+}
+
+// Node with the largest finite distance (unreachable nodes carry no information)
+inline int farthest_reachable(const std::vector<double> &d)
+{
+    int best = 0;
+    for (int v = 1; v < (int)d.size(); ++v)
+        if (d[v] != INF && (d[best] == INF || d[v] > d[best]))
+            best = v;
+    return best;
+}
+
+// One-to-all distances for preprocessing: delta-stepping when several threads are available
+template <typename GraphT>
+std::vector<double> one_to_all(const GraphT &G, int s, int threads, double delta)
+{
+    return threads > 1 ? delta_stepping(G, s, delta, threads) : dijkstra(G, s);
+}
+
+// farthest-point landmark selection: keeps the running minimum distance to the
+// chosen set, so each new landmark costs one search instead of one per landmark.
+// Each search depends on the previous landmark, so the threads go into the searches themselves.
+template <typename GraphT>
+std::vector<int> pick_landmarks(const GraphT &G, int k, int threads = default_threads())
+{
+    int n = G.size();
+    std::vector<int> L;
+    if (n == 0 || k <= 0)
+        return L;
+    L.reserve(k);
+    double delta = suggest_delta(G);
+
+    /* first landmark: farthest from vertex 0 */
+    L.push_back(farthest_reachable(one_to_all(G, 0, threads, delta)));
+
+    /* repeatedly pick vertex farthest from current landmark set */
+    std::vector<double> d_min(n, INF);
+    while ((int)L.size() < k)
+    {
+        auto dL = one_to_all(G, L.back(), threads, delta);
+        for (int v = 0; v < n; ++v)
+            d_min[v] = std::min(d_min[v], dL[v]);
+        L.push_back(farthest_reachable(d_min));
+    }
+    return L;
+}
+
+// pre-compute single-source distances from each landmark: one search per worker at a time,
+// and threads left over when there are fewer landmarks than threads go into each search
+template <typename GraphT>
+std::vector<std::vector<float>> preprocess_landmarks(const GraphT &G,
+                                                     const std::vector<int> &L,
+                                                     int threads = default_threads())
+{
+    int n = G.size(), k = L.size();
+    std::vector<std::vector<float>> dist(k, std::vector<float>(n));
+
+    int workers = std::max(1, std::min(threads, k));
+    int inner = std::max(1, threads / workers);
+    double delta = inner > 1 ? suggest_delta(G) : 0;
+    run_threads(workers, [&](int tid) {
+        for (int i = tid; i < k; i += workers)
+        {
+            auto d = one_to_all(G, L[i], inner, delta);
+            for (int v = 0; v < n; ++v)
+                dist[i][v] = (float)d[v]; // store as 32-bit
+        }
+    });
+    return dist;
+}
+
+// Node-major landmark distances: row v holds d(L_i, v) for every landmark i, padded with
+// zeros to a multiple of LANES floats, so one heuristic call reads one contiguous row
+// instead of one cache line from each of k separate per-landmark vectors
+struct LandmarkTable
+{
+    static const int LANES = 8;
+    int n = 0, k = 0, stride = 0;
+    std::vector<float> from; // n × stride: d(L_i, v)
+    std::vector<float> to;   // n × stride: d(v, L_i), empty for undirected graphs
+
+    LandmarkTable(const std::vector<std::vector<float>> &dist_from_L,
+                  const std::vector<std::vector<float>> &dist_to_L = {})
+        : n(dist_from_L.empty() ? 0 : dist_from_L[0].size()),
+          k(dist_from_L.size()),
+          stride((k + LANES - 1) / LANES * LANES),
+          from(transpose(dist_from_L)),
+          to(transpose(dist_to_L))
+    {
+    }
+    bool directed() const { return !to.empty(); }
+
+private:
+    std::vector<float> transpose(const std::vector<std::vector<float>> &rows) const
+    {
+        std::vector<float> out;
+        if (rows.empty())
+            return out;
+        out.assign((size_t)n * stride, 0.0f);
+        for (int i = 0; i < k; ++i)
+            for (int v = 0; v < n; ++v)
+                out[(size_t)v * stride + i] = rows[i][v];
+        return out;
+    }
+};
+
+// max_i |a_i - b_i| over one padded row. Lanes where both sides are INF (landmark reaches
+// neither node) give NaN and are skipped: maxps returns its second operand on NaN, and
+// the scalar comparison is false.
+inline float alt_bound(const float *a, const float *b, int stride)
+{
+#if defined(__AVX__)
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    __m256 acc = _mm256_setzero_ps();
+    for (int i = 0; i < stride; i += 8)
+    {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        acc = _mm256_max_ps(_mm256_and_ps(diff, abs_mask), acc);
+    }
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+#elif defined(__SSE2__)
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 m = _mm_setzero_ps();
+    for (int i = 0; i < stride; i += 4)
+    {
+        __m128 diff = _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+        m = _mm_max_ps(_mm_and_ps(diff, abs_mask), m);
+    }
+#else
+    float best = 0;
+    for (int i = 0; i < stride; ++i)
+    {
+        float val = std::fabs(a[i] - b[i]);
+        if (val > best)
+            best = val;
+    }
+    return best;
+#endif
+#if defined(__AVX__) || defined(__SSE2__)
+    m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(m);
+#endif
+}
+
+// Two-sided directed bound: max_i max(lt_i - from_i, to_i - tl_i), NaN lanes skipped as above
+inline float alt_bound_directed(const float *from, const float *lt, const float *to, const float *tl, int stride)
+{
+#if defined(__AVX__)
+    __m256 acc = _mm256_setzero_ps();
+    for (int i = 0; i < stride; i += 8)
+    {
+        __m256 fwd = _mm256_sub_ps(_mm256_loadu_ps(lt + i), _mm256_loadu_ps(from + i));
+        __m256 bwd = _mm256_sub_ps(_mm256_loadu_ps(to + i), _mm256_loadu_ps(tl + i));
+        acc = _mm256_max_ps(fwd, acc);
+        acc = _mm256_max_ps(bwd, acc);
+    }
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+#elif defined(__SSE2__)
+    __m128 m = _mm_setzero_ps();
+    for (int i = 0; i < stride; i += 4)
+    {
+        __m128 fwd = _mm_sub_ps(_mm_loadu_ps(lt + i), _mm_loadu_ps(from + i));
+        __m128 bwd = _mm_sub_ps(_mm_loadu_ps(to + i), _mm_loadu_ps(tl + i));
+        m = _mm_max_ps(fwd, m);
+        m = _mm_max_ps(bwd, m);
+    }
+#else
+    float best = 0;
+    for (int i = 0; i < stride; ++i)
+    {
+        float fwd = lt[i] - from[i];
+        float bwd = to[i] - tl[i];
+        if (fwd > best)
+            best = fwd;
+        if (bwd > best)
+            best = bwd;
+    }
+    return best;
+#endif
+#if defined(__AVX__) || defined(__SSE2__)
+    m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(m);
+#endif
+}
+
+// ALT heuristic object towards goal t, over a LandmarkTable that several heuristics can share
+// Undirected: h(v) = max_i |d(L_i,v) - d(L_i,t)|.
+// Directed (table built with dist_to_L, computed on the reverse graph):
+//   h(v) = max_i max(d(L_i,t) - d(L_i,v), d(v,L_i) - d(t,L_i)).
+// reversed = true gives the heuristic for a search on the reverse graph, i.e. a bound on d(t, v).
+//
+// Active landmarks: with active_count > 0, astar_best evaluates only the active_count landmarks
+// giving the best bound at the source, and every refresh_interval settled nodes (0 = never)
+// swaps in a better landmark for the node being settled. Any subset is still a consistent heuristic.
+struct MultiALT
+{
+    std::shared_ptr<const LandmarkTable> table;
+    bool reversed;
+    int k, stride;
+    const float *from; // rows of d(L_i, v) in the searched direction
+    const float *to;   // rows of d(v, L_i), nullptr for undirected graphs
+    std::vector<float> distLt; // d(L_i, t) for goal t, padded
+    std::vector<float> distTL; // d(t, L_i), directed only
+    int active_count = 0;      // 0 = use every landmark
+    int refresh_interval = 0;
+    std::vector<int> active;   // current subset (sorted), empty = all
+
+    MultiALT(std::shared_ptr<const LandmarkTable> table_, int t, bool reversed_ = false)
+        : table(std::move(table_)),
+          reversed(reversed_ && table->directed()),
+          k(table->k),
+          stride(table->stride),
+          from(reversed ? table->to.data() : table->from.data()),
+          to(!table->directed() ? nullptr : reversed ? table->from.data() : table->to.data()),
+          distLt(from + (size_t)t * stride, from + (size_t)(t + 1) * stride),
+          distTL(to ? std::vector<float>(to + (size_t)t * stride, to + (size_t)(t + 1) * stride)
+                    : std::vector<float>())
+    {
+    }
+    MultiALT(const std::vector<std::vector<float>> &dist_from_L_, int t)
+        : MultiALT(std::make_shared<const LandmarkTable>(dist_from_L_), t)
+    {
+    }
+    MultiALT(const std::vector<std::vector<float>> &dist_from_L_,
+             const std::vector<std::vector<float>> &dist_to_L_, int t)
+        : MultiALT(std::make_shared<const LandmarkTable>(dist_from_L_, dist_to_L_), t)
+    {
+    }
+    // Bound on d(v, t) given by landmark i alone (0 if the landmark reaches neither node)
+    inline float landmark_bound(int i, int v) const
+    {
+        float b = 0, fwd = distLt[i] - from[(size_t)v * stride + i];
+        if (!to)
+            fwd = std::fabs(fwd);
+        if (fwd > b)
+            b = fwd;
+        if (to)
+        {
+            float bwd = to[(size_t)v * stride + i] - distTL[i];
+            if (bwd > b)
+                b = bwd;
+        }
+        return b;
+    }
+
+    // Make the active_count landmarks with the largest bound at v active;
+    // returns whether the active set changed
+    bool select_active(int v)
+    {
+        if (active_count <= 0 || active_count >= k)
+            return false;
+        std::vector<std::pair<float, int>> bounds(k);
+        for (int i = 0; i < k; ++i)
+            bounds[i] = {-landmark_bound(i, v), i}; // largest bound first, then lowest index
+        std::partial_sort(bounds.begin(), bounds.begin() + active_count, bounds.end());
+        std::vector<int> chosen(active_count);
+        for (int j = 0; j < active_count; ++j)
+            chosen[j] = bounds[j].second;
+        std::sort(chosen.begin(), chosen.end());
+        if (chosen == active)
+            return false;
+        active = std::move(chosen);
+        return true;
+    }
+
+    // Refresh during a search: if some inactive landmark bounds d(v, t) better than the whole
+    // active set does, swap it in for the active landmark that is weakest at v; returns whether
+    // the set changed. (Re-selecting the top active_count at v instead tested clearly worse.)
+    bool refresh_active(int v)
+    {
+        if (active.empty())
+            return false;
+        float current = 0, weakest_bound = INF;
+        int weakest = -1, best = -1;
+        float best_bound = 0;
+        std::vector<char> is_active(k, 0);
+        for (int i : active)
+        {
+            is_active[i] = 1;
+            float b = landmark_bound(i, v);
+            if (b > current)
+                current = b;
+            if (b < weakest_bound)
+            {
+                weakest_bound = b;
+                weakest = i;
+            }
+        }
+        for (int i = 0; i < k; ++i)
+            if (!is_active[i])
+            {
+                float b = landmark_bound(i, v);
+                if (b > best_bound)
+                {
+                    best_bound = b;
+                    best = i;
+                }
+            }
+        if (best < 0 || best_bound <= current)
+            return false;
+        *std::find(active.begin(), active.end(), weakest) = best;
+        std::sort(active.begin(), active.end());
+        return true;
+    }
+
+    inline double operator()(int v) const
+    {
+        if (!active.empty())
+        {
+            float best = 0;
+            for (int i : active)
+            {
+                float b = landmark_bound(i, v);
+                if (b > best)
+                    best = b;
+            }
+            return best;
+        }
+        const float *row = from + (size_t)v * stride;
+        if (!to)
+            return alt_bound(row, distLt.data(), stride);
+        return alt_bound_directed(row, distLt.data(), to + (size_t)v * stride, distTL.data(), stride);
+    }
+};
+
+// A* search with ALT heuristic (see MultiALT for the active-landmark options).
+// Runs in ws and returns dist(s, t) (INF for t = -1, no target); ws.queue is a binary heap via push_heap/pop_heap,
+// so keys can be rebuilt on refresh. instr is the instrumentation policy (see instrumentation.h).
+template <typename GraphT, typename Instr = NoInstrumentation>
+double astar_best(const GraphT &G,
+                  int s, int t,
+                  const MultiALT &h_all,
+                  SearchWorkspace &ws,
+                  Instr &&instr = Instr())
+{
+    ws.begin(G.size());
+    auto &pq = ws.queue;
+    std::greater<SearchWorkspace::QueueEntry> later;
+
+    // Per-query copy so the active landmark subset can be chosen for this s-t pair
+    MultiALT h = h_all;
+    h.active.clear();
+    h.select_active(s);
+
+    ws.set_dist(s, 0);
+    pq.emplace_back(h(s), s); // f(s)=h(s)
+    instr.push();
+    int settled = 0;
+
+    while (!pq.empty())
+    {
+        std::pop_heap(pq.begin(), pq.end(), later);
+        int u = pq.back().second;
+        pq.pop_back();
+        instr.pop();
+        if (ws.settled(u))
+        {
+            instr.stale_pop();
+            continue;
+        }
+
+        ws.settle(u);
+        instr.settle(u);
+        ++settled;
+        if (u == t)
+            break; // goal reached
+
+        // New potential: every queued key must be recomputed before continuing
+        if (h.refresh_interval > 0 && settled % h.refresh_interval == 0 && h.refresh_active(u))
+        {
+            size_t kept = 0;
+            for (auto [key, x] : pq)
+                if (!ws.settled(x))
+                    pq[kept++] = {ws.dist(x) + h(x), x};
+            pq.resize(kept);
+            std::make_heap(pq.begin(), pq.end(), later);
+        }
+
+        double gu = ws.dist(u);
+        for (auto [v, w] : G[u]) {
+            instr.scan(u, v);
+            if (!ws.settled(v) && gu + w < ws.dist(v))
+            {
+                ws.set_dist(v, gu + w);
+                ws.set_prev(v, u);
+                instr.relax(v);
+                pq.emplace_back(gu + w + h(v), v);
+                std::push_heap(pq.begin(), pq.end(), later);
+                instr.push();
+            }
+        } 
+    }
+    return t >= 0 ? ws.dist(t) : INF;
+}
+
+template <typename GraphT>
+std::vector<double> astar_best(const GraphT &G,
+                               int s, int t,
+                               const MultiALT &h_all,
+                               std::vector<std::pair<int, int>>& explored_edges, 
+                               std::vector<int>& prev, 
+                               Timer* timer,
+                               int* settled_nodes = nullptr)
+{
+    SearchWorkspace ws(G.size());
+    EdgeLog log(explored_edges);
+    timed_then_traced(*timer, [&](auto &&instr) { return astar_best(G, s, t, h_all, ws, instr); }, log);
+    if (settled_nodes)
+        *settled_nodes = log.counters.settled;
+    prev = ws.predecessors();
+    return ws.distances(); // [t] holds distance
+}
+
+#endif  // ASTAR_ALT_H
@@ -0,0 +1,53 @@
+//Bidirectional ALT A*: forward search from s and backward search from t, both driven by the
+//average landmark potential, with the bidirectional Dijkstra stopping rule.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/trace_sink.h"
+#include "astar_alt.h"
+#include "landmark_cache.h"
+#include "astar_bidir.h"
+#include <iostream>
+#include <bits/stdc++.h>
+
+using namespace std;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        string explored_output = "../map_data/graph_" + name + "_visited_edges_astar_bidir_alt.txt";
+        string path_output = "../map_data/graph_" + name + "_final_nodes_astar_bidir_alt.txt";
+
+        Timer runtime;
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
+        bool directed = read_graph_header(input).directed;
+        CSRGraph32 R = directed ? reverse_graph(G) : G;
+        int s = source;
+        int t = static_cast<int>(G.size()) - 1;
+        bool reachable = may_reach(input, G, s, t);
+        SearchWorkspace fwd(G.size()), bwd(G.size());
+
+        int k = 8; // number of landmarks
+        LandmarkTables T = landmark_tables(G, directed, k, landmark_cache_path(input, k));
+        MultiALT h_t(T.dist_from_L, T.dist_to_L, t);
+        MultiALT h_s = reversed_alt(h_t, s);
+
+        auto search = [&](auto&& instr) { return reachable ? astar_bidir_alt(G, R, s, t, h_t, h_s, fwd, bwd, instr) : INF; };
+        double dist = timed_then_streamed(runtime, search, explored_output);
+        write_path(path_output, fwd.path(t));
+
+        cout << "Shortest distance (" << name << "): " << dist << "\n";
+        cout << "Time (" << name << "): " << runtime.elapsed() << " seconds\n";
+    }
+}
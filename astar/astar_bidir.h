@@ -0,0 +1,135 @@
+//Bidirectional ALT A*: forward search from s and backward search from t, both driven by the
+//average potential p(v) = (h_t(v) - h_s(v)) / 2 built from the landmark bounds, which is consistent
+//for both directions, so the bidirectional Dijkstra stopping rule top_f + top_b >= best still holds.
+#ifndef ASTAR_BIDIR_H
+#define ASTAR_BIDIR_H
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "astar_alt.h"
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <functional>
+
+// Landmark heuristic towards s on the reverse graph, i.e. h(v) <= d(s, v); shares h's table
+inline MultiALT reversed_alt(const MultiALT &h, int s)
+{
+    return MultiALT(h.table, s, !h.reversed);
+}
+
+// R is the reverse graph of G (pass G itself for undirected graphs);
+// h_t bounds d(v, t), h_s bounds d(s, v) (see reversed_alt).
+// Runs in two workspaces and returns dist(s, t); the s -> t path is fwd.path(t).
+template <typename GraphT, typename Instr = NoInstrumentation>
+double astar_bidir_alt(const GraphT &G,
+                       const GraphT &R,
+                       int s, int t,
+                       const MultiALT &h_t,
+                       const MultiALT &h_s,
+                       SearchWorkspace &fwd,
+                       SearchWorkspace &bwd,
+                       Instr &&instr = Instr())
+{
+    int n = G.size();
+    fwd.begin(n);
+    bwd.begin(n); // bwd's prev is the backward tree: next node towards t
+    std::greater<SearchWorkspace::QueueEntry> later;
+    auto &pqf = fwd.queue, &pqb = bwd.queue;
+
+    // Forward key g + p(v), backward key g - p(v); INF when a landmark proves v is off every s-t path
+    auto potential = [&](int v) {
+        double to_t = h_t(v), from_s = h_s(v);
+        if (to_t == INF || from_s == INF)
+            return INF;
+        return 0.5 * (to_t - from_s);
+    };
+
+    fwd.set_dist(s, 0);
+    bwd.set_dist(t, 0);
+    pqf.emplace_back(potential(s), s);
+    pqb.emplace_back(-potential(t), t);
+    instr.push();
+    instr.push();
+
+    double best = (s == t) ? 0 : INF;
+    int mu = s, mv = s; // best path so far: s ~> mu -> mv ~> t
+
+    while (!pqf.empty() && !pqb.empty())
+    {
+        if (pqf.front().first + pqb.front().first >= best)
+            break;
+        bool forward = pqf.front().first <= pqb.front().first;
+        auto &ws = forward ? fwd : bwd;
+        const auto &other = forward ? bwd : fwd;
+        auto &pq = ws.queue;
+
+        std::pop_heap(pq.begin(), pq.end(), later);
+        int u = pq.back().second;
+        pq.pop_back();
+        instr.pop();
+        if (ws.settled(u))
+        {
+            instr.stale_pop();
+            continue;
+        }
+        ws.settle(u);
+        instr.settle(u);
+        double gu = ws.dist(u);
+
+        for (auto [v, w] : (forward ? G[u] : R[u]))
+        {
+            if (forward)
+                instr.scan(u, v);
+            else
+                instr.scan(v, u); // graph direction
+            double ov = other.dist(v);
+            if (ov != INF && gu + w + ov < best)
+            {
+                best = gu + w + ov;
+                mu = forward ? u : v;
+                mv = forward ? v : u;
+            }
+            if (!ws.settled(v) && gu + w < ws.dist(v))
+            {
+                double p = potential(v);
+                if (p != INF)
+                {
+                    ws.set_dist(v, gu + w);
+                    ws.set_prev(v, u);
+                    instr.relax(v);
+                    pq.emplace_back(forward ? gu + w + p : gu + w - p, v);
+                    std::push_heap(pq.begin(), pq.end(), later);
+                    instr.push();
+                }
+            }
+        }
+    }
+
+    if (best != INF)
+        join_bidir_path(mu, mv, best, bwd, fwd);
+    return best;
+}
+
+template <typename GraphT>
+std::vector<double> astar_bidir_alt(const GraphT &G,
+                                    const GraphT &R,
+                                    int s, int t,
+                                    const MultiALT &h_t,
+                                    const MultiALT &h_s,
+                                    std::vector<std::pair<int, int>>& explored_edges,
+                                    std::vector<int>& prev,
+                                    Timer* timer,
+                                    int* settled_nodes = nullptr)
+{
+    SearchWorkspace fwd(G.size()), bwd(G.size());
+    EdgeLog log(explored_edges);
+    timed_then_traced(*timer, [&](auto &&instr) { return astar_bidir_alt(G, R, s, t, h_t, h_s, fwd, bwd, instr); }, log);
+    if (settled_nodes)
+        *settled_nodes = log.counters.settled;
+    prev = fwd.predecessors();
+    return fwd.distances(); // [t] holds distance
+}
+
+#endif  // ASTAR_BIDIR_H
@@ -2,75 +2,16 @@
 
 #include "../helpers/timer.h"
 #include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/trace_sink.h"
+#include "../helpers/geo_heuristic.h"
+#include "astar_weighted.h"
 #include <iostream>
 // Weighted A* (ε-optimal): uses f = g + w·h with w > 1 (e.g., 1.5) to bias the search toward the goal, finding a path no worse than w times optimal much faster.
 
 #include <bits/stdc++.h>
 
 using namespace std;
-const double INF = numeric_limits<double>::infinity();
-
-/* ---------- Weighted A* ---------- */
-vector<double> astar_weighted(const Graph &G,
-                              int s, int t,
-                              const vector<double> &h,
-                              double w,
-                              std::vector<std::pair<int, int>>& explored_edges, 
-                              vector<int>& prev, 
-                              Timer* timer                            
-                            )
-{
-    timer->start();
-    int n = G.size();
-    vector<double> g(n, INF);
-    vector<char> vis(n, 0);
-
-    using Node = pair<double, int>; // (f,vertex)
-    priority_queue<Node, vector<Node>, greater<Node>> pq;
-
-    g[s] = 0;
-    pq.emplace(w * h[s], s); // f = g + w·h
-
-    // For path reconstruction
-    timer->pause();
-    prev.assign(n, -1);
-    timer->start();
-
-
-    while (!pq.empty())
-    {
-        auto [f, u] = pq.top();
-        pq.pop();
-        if (vis[u])
-            continue;
-
-        vis[u] = 1;
-        if (u == t)
-            break; // goal reached
-
-        for (auto [v, wt] : G[u])
-        {
-            if (!vis[v] && g[u] + wt < g[v])
-            {
-                g[v] = g[u] + wt;
-
-                timer->pause();
-                prev[v] = u;
-                timer->start();
-
-                pq.emplace(g[v] + w * h[v], v);
-            }
-
-            // Logging visited edges
-            timer->pause();
-            explored_edges.push_back({u, v});
-            timer->start();
-        }
-    }
-
-    timer->pause();
-    return g; // g[t] is the path cost
-}
 
 int main()
 {
@@ -81,25 +22,39 @@ int main()
 
     for (const auto& [name, source] : datasets) {
         string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
         string explored_output = "../map_data/graph_" + name + "_visited_edges_astar_weighted.txt";
         string path_output = "../map_data/graph_" + name + "_final_nodes_astar_weighted.txt";
 
         Timer runtime;
-        Graph G = read_graph(input);
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
         int s = source;
         int t = static_cast<int>(G.size()) - 1;
-        vector<int> prev;
-        std::vector<std::pair<int, int>> explored;
-
-        /* Heuristic: all zeros (admissible but uninformed).
-        Replace with domain-specific values for better speed. */
-        vector<double> h(G.size(), 0.0);
-
-        auto dist = astar_weighted(G, s, t, h, 1.5, explored, prev, &runtime); // w = 1.5
-        write_edges(explored_output, explored);
-        write_path(path_output, reconstruct_path(prev, t));
+        bool reachable = may_reach(input, G, s, t);
+        SearchWorkspace ws(G.size());
+        auto run = [&](const auto& h) {
+            auto search = [&](auto&& instr) { return reachable ? astar_weighted(G, s, t, h, 1.5, ws, instr) : INF; }; // w = 1.5
+            return timed_then_streamed(runtime, search, explored_output);
+        };
+
+        // Heuristic: scaled straight-line distance to t (all zeros if no coordinates are available)
+        string nodes = "../map_data/graph_" + name + "_nodes.txt";
+        vector<LatLon> coords = open_coords(input, nodes, G.size());
+        double dist = INF;
+        if (coords.empty()) {
+            if (reachable)
+                cout << "No coordinates for " << name << ", running with h = 0\n";
+            dist = run(vector<double>(G.size(), 0.0));
+        } else {
+            GeoModel model(G, std::move(coords));
+            dist = run(GeoHeuristic(model, t));
+        }
+        write_path(path_output, ws.path(t));
 
-        cout << "Shortest distance (" << name << "): " << dist[t] << "\n";
+        cout << "Shortest distance (" << name << "): " << dist << "\n";
         cout << "Time (" << name << "): " << runtime.elapsed() << " seconds\n";
     }
 }
@@ -0,0 +1,89 @@
+//Weighted A* (ε-optimal): uses f = g + w·h with w > 1 (e.g., 1.5) to bias the search toward the goal, finding a path no worse than w times optimal much faster.
+#ifndef ASTAR_WEIGHTED_H
+#define ASTAR_WEIGHTED_H
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <functional>
+
+// h is either a precomputed vector or a callable h(v) (e.g. GeoHeuristic)
+inline double heuristic_at(const std::vector<double> &h, int v) { return h[v]; }
+template <typename Heuristic>
+double heuristic_at(const Heuristic &h, int v) { return h(v); }
+
+/* ---------- Weighted A* ---------- */
+// Runs in ws and returns the found path's cost g(t) (INF for t = -1, no target); instr is the instrumentation policy
+template <typename GraphT, typename Heuristic, typename Instr = NoInstrumentation>
+double astar_weighted(const GraphT &G,
+                      int s, int t,
+                      const Heuristic &h,
+                      double w,
+                      SearchWorkspace &ws,
+                      Instr &&instr = Instr())
+{
+    ws.begin(G.size());
+    auto &pq = ws.queue; // (f,vertex) binary heap
+    std::greater<SearchWorkspace::QueueEntry> later;
+
+    ws.set_dist(s, 0);
+    pq.emplace_back(w * heuristic_at(h, s), s); // f = g + w·h
+    instr.push();
+
+    while (!pq.empty())
+    {
+        std::pop_heap(pq.begin(), pq.end(), later);
+        int u = pq.back().second;
+        pq.pop_back();
+        instr.pop();
+        if (ws.settled(u))
+        {
+            instr.stale_pop();
+            continue;
+        }
+
+        ws.settle(u);
+        instr.settle(u);
+        if (u == t)
+            break; // goal reached
+
+        double gu = ws.dist(u);
+        for (auto [v, wt] : G[u])
+        {
+            instr.scan(u, v);
+            if (!ws.settled(v) && gu + wt < ws.dist(v))
+            {
+                ws.set_dist(v, gu + wt);
+                ws.set_prev(v, u);
+                instr.relax(v);
+                pq.emplace_back(gu + wt + w * heuristic_at(h, v), v);
+                std::push_heap(pq.begin(), pq.end(), later);
+                instr.push();
+            }
+        }
+    }
+    return t >= 0 ? ws.dist(t) : INF;
+}
+
+template <typename GraphT, typename Heuristic>
+std::vector<double> astar_weighted(const GraphT &G,
+                                   int s, int t,
+                                   const Heuristic &h,
+                                   double w,
+                                   std::vector<std::pair<int, int>>& explored_edges, 
+                                   std::vector<int>& prev, 
+                                   Timer* timer                            
+                                 )
+{
+    SearchWorkspace ws(G.size());
+    EdgeLog log(explored_edges);
+    timed_then_traced(*timer, [&](auto &&instr) { return astar_weighted(G, s, t, h, w, ws, instr); }, log);
+    prev = ws.predecessors();
+    return ws.distances(); // [t] is the path cost
+}
+
+#endif  // ASTAR_WEIGHTED_H
@@ -0,0 +1,114 @@
+//Landmark tables for ALT, cached on disk next to the edge file so only the first run
+//pays for landmark selection and the k (or 2k, if directed) full-graph searches.
+#ifndef LANDMARK_CACHE_H
+#define LANDMARK_CACHE_H
+
+#include "../helpers/graph_io.h"
+#include "../helpers/parallel.h"
+#include "astar_alt.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Cache file (little-endian): magic, version, graph checksum, n, k, directed flag,
+// then landmarks[k], dist_from_L[k][n] and, if directed, dist_to_L[k][n] as float
+const char LANDMARK_MAGIC[8] = {'D', 'V', 'A', 'L', 'M', 'A', 'R', 'K'};
+const uint32_t LANDMARK_VERSION = 2;
+
+struct LandmarkTables
+{
+    std::vector<int> landmarks;
+    std::vector<std::vector<float>> dist_from_L; // k × n
+    std::vector<std::vector<float>> dist_to_L;   // k × n, empty for undirected graphs
+};
+
+// "../input_edges/graph_x_edges.txt", k = 16 -> "../input_edges/graph_x_edges_k16.alt"
+inline std::string landmark_cache_path(const std::string &text_filename, int k)
+{
+    std::string base = text_filename;
+    size_t dot = base.rfind('.');
+    if (dot != std::string::npos && base.find('/', dot) == std::string::npos)
+        base.erase(dot);
+    return base + "_k" + std::to_string(k) + ".alt";
+}
+
+inline void save_landmarks(const std::string &filename, uint64_t checksum, const LandmarkTables &T)
+{
+    std::ofstream out(filename, std::ios::binary);
+    uint32_t k = T.landmarks.size();
+    uint32_t n = T.dist_from_L.empty() ? 0 : T.dist_from_L[0].size();
+    uint32_t directed = !T.dist_to_L.empty();
+    out.write(LANDMARK_MAGIC, sizeof(LANDMARK_MAGIC));
+    out.write(reinterpret_cast<const char *>(&LANDMARK_VERSION), sizeof(LANDMARK_VERSION));
+    out.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+    out.write(reinterpret_cast<const char *>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char *>(&k), sizeof(k));
+    out.write(reinterpret_cast<const char *>(&directed), sizeof(directed));
+    out.write(reinterpret_cast<const char *>(T.landmarks.data()), k * sizeof(int));
+    for (const auto &row : T.dist_from_L)
+        out.write(reinterpret_cast<const char *>(row.data()), n * sizeof(float));
+    for (const auto &row : T.dist_to_L)
+        out.write(reinterpret_cast<const char *>(row.data()), n * sizeof(float));
+    if (!out)
+        throw std::runtime_error("cannot write " + filename);
+}
+
+// Fill T from the cache if it exists and was built for this graph, k and directedness
+inline bool load_landmarks(const std::string &filename, uint64_t checksum, int n, int k, bool directed,
+                           LandmarkTables &T)
+{
+    std::ifstream in(filename, std::ios::binary);
+    char magic[8];
+    uint32_t version = 0, file_n = 0, file_k = 0, file_directed = 0;
+    uint64_t file_checksum = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    in.read(reinterpret_cast<char *>(&file_checksum), sizeof(file_checksum));
+    in.read(reinterpret_cast<char *>(&file_n), sizeof(file_n));
+    in.read(reinterpret_cast<char *>(&file_k), sizeof(file_k));
+    in.read(reinterpret_cast<char *>(&file_directed), sizeof(file_directed));
+    if (!in || std::memcmp(magic, LANDMARK_MAGIC, sizeof(magic)) != 0 || version != LANDMARK_VERSION ||
+        file_checksum != checksum || (int)file_n != n || (int)file_k != k || (file_directed != 0) != directed)
+        return false;
+
+    T.landmarks.resize(k);
+    T.dist_from_L.assign(k, std::vector<float>(n));
+    T.dist_to_L.assign(directed ? k : 0, std::vector<float>(n));
+    in.read(reinterpret_cast<char *>(T.landmarks.data()), k * sizeof(int));
+    for (auto &row : T.dist_from_L)
+        in.read(reinterpret_cast<char *>(row.data()), n * sizeof(float));
+    for (auto &row : T.dist_to_L)
+        in.read(reinterpret_cast<char *>(row.data()), n * sizeof(float));
+    return static_cast<bool>(in);
+}
+
+// Landmark tables for G: loaded from cache_file when it matches, otherwise computed
+// (landmark searches in parallel) and written there; pass "" to skip the cache
+template <typename GraphT>
+LandmarkTables landmark_tables(const GraphT &G, bool directed, int k, const std::string &cache_file,
+                               bool *from_cache = nullptr, int threads = default_threads())
+{
+    LandmarkTables T;
+    uint64_t checksum = graph_checksum(G);
+    bool hit = !cache_file.empty() && load_landmarks(cache_file, checksum, G.size(), k, directed, T);
+    if (!hit)
+    {
+        // On directed graphs, farthest-point selection by forward distance favours nodes that
+        // reach almost nothing; spreading landmarks over the symmetric graph gives useful ones
+        T.landmarks = directed ? pick_landmarks(symmetric_graph(G), k, threads) : pick_landmarks(G, k, threads);
+        T.dist_from_L = preprocess_landmarks(G, T.landmarks, threads);
+        // Directed graphs also need d(v, L), i.e. landmark searches on the reverse graph
+        if (directed)
+            T.dist_to_L = preprocess_landmarks(reverse_graph(G), T.landmarks, threads);
+        if (!cache_file.empty())
+            save_landmarks(cache_file, checksum, T);
+    }
+    if (from_cache)
+        *from_cache = hit;
+    return T;
+}
+
+#endif  // LANDMARK_CACHE_H
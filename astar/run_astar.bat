@@ -7,12 +7,15 @@ REM Create build and statistics folders if not existing
 if not exist ..\build mkdir ..\build
 if not exist ..\statistics mkdir ..\statistics
 
-echo [1/2] Compiling astar_weighted...
+echo [1/3] Compiling astar_weighted...
 g++ -std=c++17 -I..\helpers astar_weighted.cpp ..\helpers\timer.cpp -o ..\build\astar_weighted.exe
 
-echo [2/2] Compiling astar_alt...
+echo [2/3] Compiling astar_alt...
 g++ -std=c++17 -I..\helpers astar_alt.cpp ..\helpers\timer.cpp -o ..\build\astar_alt.exe
 
+echo [3/3] Compiling astar_bidir...
+g++ -std=c++17 -I..\helpers astar_bidir.cpp ..\helpers\timer.cpp -o ..\build\astar_bidir.exe
+
 echo ==============================
 echo Running All A* Variants
 echo ==============================
@@ -25,6 +28,11 @@ echo ==============================
 echo Running astar_alt...
 ..\build\astar_alt.exe
 
+echo ==============================
+
+echo Running astar_bidir...
+..\build\astar_bidir.exe
+
 
 echo ==============================
 echo ✅ All A* variants completed.
@@ -0,0 +1,144 @@
+//Batch query engine: answers a file of (source, target) pairs with any search kernel, spread over a
+//thread pool with work stealing. Workers share the read-only graph (and landmark table) and each
+//owns a SearchWorkspace, so a query costs only the nodes it visits.
+#ifndef BATCH_ENGINE_H
+#define BATCH_ENGINE_H
+
+#include "../helpers/graph_io.h"
+#include "../helpers/parallel.h"
+#include "../helpers/search_workspace.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct Query {
+    int s, t;
+};
+
+// Read "s t" lines; blank lines and lines starting with '#' are skipped
+inline std::vector<Query> read_queries(const std::string& filename, int n) {
+    std::ifstream in(filename);
+    if (!in)
+        throw std::runtime_error("cannot open " + filename);
+    std::vector<Query> queries;
+    std::string line;
+    for (int line_no = 1; std::getline(in, line); ++line_no) {
+        if (line.empty() || line[0] == '#' || line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+        std::istringstream row(line);
+        Query q;
+        if (!(row >> q.s >> q.t) || q.s < 0 || q.s >= n || q.t < 0 || q.t >= n)
+            throw std::runtime_error(filename + ":" + std::to_string(line_no) + ": expected two node ids below " +
+                                     std::to_string(n));
+        queries.push_back(q);
+    }
+    return queries;
+}
+
+inline void write_queries(const std::string& filename, const std::vector<Query>& queries) {
+    std::ofstream out(filename);
+    out << "# source target\n";
+    for (const Query& q : queries)
+        out << q.s << " " << q.t << "\n";
+}
+
+// count uniformly random pairs (fixed seed, so every run sees the same batch)
+inline std::vector<Query> random_queries(int n, int count, unsigned seed = 42) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> node(0, n - 1);
+    std::vector<Query> queries(count);
+    for (Query& q : queries)
+        q = {node(rng), node(rng)};
+    return queries;
+}
+
+// A kernel answers one query in the given workspace and returns dist(s, t); the path is ws.path(t).
+// Kernels run uninstrumented (NoInstrumentation), so nothing is logged.
+using BatchKernel = std::function<double(int s, int t, SearchWorkspace& ws)>;
+
+struct BatchResult {
+    int threads = 1;
+    double wall = 0;                      // seconds for the whole batch
+    std::vector<double> dist;             // per query
+    std::vector<double> latency;          // per query, seconds for the whole kernel call
+    std::vector<std::vector<int>> paths;  // per query, empty unless requested
+};
+
+// Run every query on `threads` workers; results are stored by query index, so the output
+// does not depend on the schedule
+inline BatchResult run_batch(int n, const std::vector<Query>& queries, const BatchKernel& kernel,
+                             int threads, bool keep_paths = false) {
+    BatchResult r;
+    r.threads = std::max(1, threads);
+    r.dist.assign(queries.size(), INF);
+    r.latency.assign(queries.size(), 0);
+    if (keep_paths)
+        r.paths.resize(queries.size());
+
+    std::vector<SearchWorkspace> workspaces(r.threads);
+    for (SearchWorkspace& ws : workspaces)
+        ws.begin(n);  // allocate before the clock starts
+
+    auto start = std::chrono::steady_clock::now();
+    parallel_for_stealing(queries.size(), r.threads, [&](size_t i, int tid) {
+        SearchWorkspace& ws = workspaces[tid];
+        auto query_start = std::chrono::steady_clock::now();
+        r.dist[i] = kernel(queries[i].s, queries[i].t, ws);
+        r.latency[i] = std::chrono::duration<double>(std::chrono::steady_clock::now() - query_start).count();
+        if (keep_paths && r.dist[i] != INF)  // kernels may answer INF without searching
+            r.paths[i] = ws.path(queries[i].t);
+    });
+    r.wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return r;
+}
+
+struct BatchStats {
+    double qps = 0;  // queries per second of wall time
+    double p50 = 0;  // latency percentiles, seconds
+    double p99 = 0;
+};
+
+// Nearest-rank percentile of sorted values, q in [0, 1]
+inline double percentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty())
+        return 0;
+    size_t rank = static_cast<size_t>(std::ceil(q * sorted.size()));
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+inline BatchStats batch_stats(const BatchResult& r) {
+    BatchStats st;
+    std::vector<double> lat = r.latency;
+    std::sort(lat.begin(), lat.end());
+    st.qps = r.wall > 0 ? lat.size() / r.wall : 0;
+    st.p50 = percentile(lat, 0.50);
+    st.p99 = percentile(lat, 0.99);
+    return st;
+}
+
+// "s t dist" per query ("inf" if unreachable), followed by the path's nodes when kept
+inline void write_batch_results(const std::string& filename, const std::vector<Query>& queries,
+                                const BatchResult& r) {
+    std::ofstream out(filename);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        out << queries[i].s << " " << queries[i].t << " ";
+        if (r.dist[i] == INF)
+            out << "inf";
+        else
+            out << r.dist[i];
+        if (!r.paths.empty())
+            for (int v : r.paths[i])
+                out << " " << v;
+        out << "\n";
+    }
+}
+
+#endif  // BATCH_ENGINE_H
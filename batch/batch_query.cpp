@@ -0,0 +1,297 @@
+// Batch queries: answers many (source, target) pairs per dataset in parallel and reports
+// throughput, p50/p99 latency and scaling from 1 thread to all cores.
+//
+//   batch_query [--largest] [--reorder] [--chains]
+//       every dataset below, every kernel; queries from ../input_edges/graph_<name>_queries.txt
+//       (created with random pairs if missing), distances to ../map_data/graph_<name>_batch_<kernel>.txt
+//   batch_query <edges.txt> <queries.txt> <kernel> <out.txt> [threads] [--paths] [--largest] [--reorder] [--chains]
+//       one kernel on one query file; --paths appends each path's nodes to its line
+//
+// Pairs in different components (graph_components.h) are answered INF without a search; --largest
+// keeps only the largest strongly connected component, so every query on it has an answer, and
+// answers queries on the dropped nodes with INF. --reorder renumbers the nodes for cache locality
+// after loading (see graph_order.h), --chains then collapses degree-2 chains and searches the
+// compressed core (see graph_chains.h); query and output files keep the original ids, paths include
+// the chain nodes.
+//
+// Kernels: dijk_lazy, dijk_decKey, astar_alt, astar_weighted
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/geo_heuristic.h"
+#include "../helpers/graph_order.h"
+#include "../helpers/graph_chains.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_decKey.h"
+#include "../astar/astar_alt.h"
+#include "../astar/astar_weighted.h"
+#include "../astar/landmark_cache.h"
+#include "batch_engine.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int DEFAULT_QUERIES = 1000;
+const vector<string> KERNELS = {"dijk_lazy", "dijk_decKey", "astar_alt", "astar_weighted"};
+
+// Shared read-only state of one dataset; heuristics are built lazily, only for kernels that need them
+struct Dataset {
+    string input, nodes;
+    CSRGraph32 G;         // the graph searched: the kept nodes, renumbered by reorder()
+    CSRGraph32 original;  // as loaded; landmarks are computed (and cached) on it
+    ComponentIndex components;  // of original
+    NodeSubset kept;      // original <-> kept ids: every node, or the largest component
+    NodeOrder order;      // kept <-> searched ids
+    unique_ptr<ChainGraph32> chains;  // with --chains: kernels search its core, ids are its compressed ids
+    shared_ptr<const LandmarkTable> landmarks;
+    unique_ptr<GeoModel> geo;
+    bool has_coords = false;
+};
+
+Dataset load_dataset(const string& input, const string& nodes, bool largest)
+{
+    Dataset D;
+    D.input = input;
+    D.nodes = nodes;
+    D.original = open_graph(input);  // binary if convert_graph was run
+    D.components = open_components(input, D.original, read_graph_header(input).directed);
+    cout << "Components: " << D.components.summary() << "\n";
+    if (largest) {
+        D.kept = largest_component(D.components);
+        D.G = induced_graph(D.original, D.kept);
+        cout << "Kept the largest component: " << D.G.size() << " nodes, " << D.G.num_edges() << " arcs\n";
+    } else {
+        D.kept = NodeSubset::all(D.original.size());
+        D.G = D.original;
+    }
+    D.order = NodeOrder::identity(D.G.size());
+    return D;
+}
+
+// Renumber D.G along a Hilbert curve (or in RCM order without coordinates)
+void reorder(Dataset& D)
+{
+    auto start = chrono::steady_clock::now();
+    vector<LatLon> coords = select_values(open_coords(D.input, D.nodes, D.original.size()), D.kept);
+    D.order = locality_order(D.G, coords);
+    D.G = permute_graph(D.G, D.order);
+    cout << "Reordered (" << (coords.empty() ? "rcm" : "hilbert") << ") in "
+         << chrono::duration<double>(chrono::steady_clock::now() - start).count() << " seconds\n";
+}
+
+// Collapse the degree-2 chains of D.G (after reorder(), if any)
+void compress(Dataset& D)
+{
+    auto start = chrono::steady_clock::now();
+    D.chains = make_unique<ChainGraph32>(compress_chains(D.G));
+    cout << "Compressed chains: " << D.G.size() << " -> " << D.chains->core_size() << " nodes, "
+         << D.G.num_edges() << " -> " << D.chains->core.num_edges() << " arcs in "
+         << chrono::duration<double>(chrono::steady_clock::now() - start).count() << " seconds\n";
+}
+
+// Node id (-1 if not kept) and per-node values in the ids the kernels search
+int searched_id(const Dataset& D, int v)
+{
+    v = D.kept.to_new[v];
+    if (v < 0)
+        return -1;
+    v = D.order.to_new[v];
+    return D.chains ? D.chains->order.to_new[v] : v;
+}
+
+template <typename T>
+vector<T> searched_values(const Dataset& D, const vector<T>& values)
+{
+    vector<T> out = permute_values(select_values(values, D.kept), D.order);
+    return D.chains ? permute_values(out, D.chains->order) : out;
+}
+
+// Queries in searched ids, and results back in original ids
+vector<Query> to_searched(const Dataset& D, vector<Query> queries)
+{
+    for (Query& q : queries)
+        q = {searched_id(D, q.s), searched_id(D, q.t)};
+    return queries;
+}
+
+void to_original(const Dataset& D, BatchResult& r)
+{
+    for (auto& path : r.paths)
+        path = D.kept.original(D.order.original(D.chains ? D.chains->expand(path) : path));
+}
+
+// INF at once for pairs in different components and for nodes dropped by --largest
+BatchKernel reject_unreachable(const Dataset& D, BatchKernel kernel)
+{
+    auto index = make_shared<ComponentIndex>();
+    index->directed = D.components.directed;
+    index->weak = searched_values(D, D.components.weak);
+    index->strong = searched_values(D, D.components.strong);
+    return [index, kernel](int s, int t, SearchWorkspace& ws) {
+        if (s < 0 || t < 0 || !index->may_reach(s, t))
+            return INF;
+        return kernel(s, t, ws);
+    };
+}
+
+// search(graph, s, t, ws) on D.G, or with --chains on the core with the query's endpoints attached
+template <typename Search>
+BatchKernel on_graph(const Dataset& D, Search search)
+{
+    if (!D.chains)
+        return [&G = D.G, search](int s, int t, SearchWorkspace& ws) { return search(G, s, t, ws); };
+    const ChainGraph32* C = D.chains.get();
+    return [C, search](int s, int t, SearchWorkspace& ws) { return search(C->query(s, t), s, t, ws); };
+}
+
+BatchKernel make_kernel(Dataset& D, const string& kernel)
+{
+    if (kernel == "dijk_lazy")
+        return on_graph(D, [](const auto& G, int s, int t, SearchWorkspace& ws) {
+            return dijkstra_lazy(G, s, t, ws);
+        });
+    if (kernel == "dijk_decKey")
+        return on_graph(D, [](const auto& G, int s, int t, SearchWorkspace& ws) {
+            return dijkstra_dary(G, s, t, ws);
+        });
+    if (kernel == "astar_alt") {
+        if (!D.landmarks) {
+            int k = 16;  // same setup as the astar_alt main
+            LandmarkTables T = landmark_tables(D.original, read_graph_header(D.input).directed, k,
+                                               landmark_cache_path(D.input, k));
+            for (auto& row : T.dist_from_L)
+                row = searched_values(D, row);
+            for (auto& row : T.dist_to_L)
+                row = searched_values(D, row);
+            D.landmarks = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+        }
+        auto table = D.landmarks;
+        return on_graph(D, [table](const auto& G, int s, int t, SearchWorkspace& ws) {
+            MultiALT h(table, t);
+            h.active_count = 4;
+            h.refresh_interval = 100;
+            return astar_best(G, s, t, h, ws);
+        });
+    }
+    if (kernel == "astar_weighted") {
+        if (!D.geo) {
+            vector<LatLon> coords = searched_values(D, open_coords(D.input, D.nodes, D.original.size()));
+            D.has_coords = !coords.empty();
+            // scale from the uncompressed arcs: the arcs attaching chain interiors are parts of chains
+            if (D.has_coords)
+                D.geo = make_unique<GeoModel>(D.chains ? permute_graph(D.G, D.chains->order) : D.G, std::move(coords));
+        }
+        const GeoModel* geo = D.geo.get();
+        return on_graph(D, [geo](const auto& G, int s, int t, SearchWorkspace& ws) {
+            // Uncached straight-line bound: no per-query O(n) cache (h = 0 without coordinates)
+            auto h = [geo, t](int v) { return geo ? geo->bound(v, t) : 0.0; };
+            return astar_weighted(G, s, t, h, 1.5, ws); // w = 1.5
+        });
+    }
+    throw runtime_error("unknown kernel " + kernel);
+}
+
+void print_header()
+{
+    cout << "  kernel            threads    queries/s    p50 (us)    p99 (us)   speedup\n";
+}
+
+void print_row(const string& kernel, const BatchResult& r, double base_qps)
+{
+    BatchStats st = batch_stats(r);
+    cout << "  " << left << setw(16) << kernel << right << setw(9) << r.threads << fixed << setprecision(1)
+         << setw(13) << st.qps << setw(12) << st.p50 * 1e6 << setw(12) << st.p99 * 1e6 << setprecision(2)
+         << setw(9) << (base_qps > 0 ? st.qps / base_qps : 1.0) << "x\n";
+}
+
+// 1, 2, 4, ... up to all cores (always including the core count itself)
+vector<int> thread_counts()
+{
+    vector<int> counts;
+    int max_threads = default_threads();
+    for (int th = 1; th < max_threads; th *= 2)
+        counts.push_back(th);
+    counts.push_back(max_threads);
+    return counts;
+}
+
+int main(int argc, char** argv)
+{
+    vector<string> args;
+    bool paths = false, largest = false, renumber = false, chains = false;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--paths")
+            paths = true;
+        else if (arg == "--largest")
+            largest = true;
+        else if (arg == "--reorder")
+            renumber = true;
+        else if (arg == "--chains")
+            chains = true;
+        else
+            args.push_back(arg);
+    }
+
+    if (args.size() >= 4) {
+        Dataset D = load_dataset(args[0], "", largest);
+        if (renumber)
+            reorder(D);
+        if (chains)
+            compress(D);
+        int threads = args.size() >= 5 ? stoi(args[4]) : default_threads();
+        vector<Query> queries = read_queries(args[1], D.original.size());
+        BatchResult r = run_batch(D.G.size(), to_searched(D, queries), reject_unreachable(D, make_kernel(D, args[2])),
+                                  threads, paths);
+        to_original(D, r);
+        write_batch_results(args[3], queries, r);
+        print_header();
+        print_row(args[2], r, batch_stats(r).qps);
+        return 0;
+    }
+
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        Dataset D = load_dataset(input, "../map_data/graph_" + name + "_nodes.txt", largest);
+        if (renumber)
+            reorder(D);
+        if (chains)
+            compress(D);
+        int n = D.original.size();  // query ids
+
+        string query_file = "../input_edges/graph_" + name + "_queries.txt";
+        if (!ifstream(query_file)) {
+            vector<Query> generated = random_queries(n, DEFAULT_QUERIES - 1);
+            generated.insert(generated.begin(), {source, n - 1});  // the mains' query first
+            write_queries(query_file, generated);
+            cout << "Wrote " << generated.size() << " random queries to " << query_file << "\n";
+        }
+        vector<Query> queries = read_queries(query_file, n);
+        vector<Query> searched = to_searched(D, queries);
+        cout << "== " << name << " (" << D.G.size() << " nodes, " << queries.size() << " queries) ==\n";
+
+        print_header();
+        for (const string& kernel : KERNELS) {
+            BatchKernel run = reject_unreachable(D, make_kernel(D, kernel));
+            double base_qps = 0;
+            for (int threads : thread_counts()) {
+                BatchResult r = run_batch(D.G.size(), searched, run, threads);
+                if (threads == 1) {
+                    base_qps = batch_stats(r).qps;
+                    write_batch_results("../map_data/graph_" + name + "_batch_" + kernel + ".txt", queries, r);
+                }
+                print_row(kernel, r, base_qps);
+            }
+        }
+    }
+}
@@ -0,0 +1,22 @@
+@echo off
+echo ==============================
+echo Compiling Batch Queries
+echo ==============================
+
+REM Create build folder if not existing
+if not exist ..\build mkdir ..\build
+
+echo [1/1] Compiling batch_query...
+g++ -std=c++17 -O2 -I..\helpers batch_query.cpp ..\helpers\timer.cpp -o ..\build\batch_query.exe
+
+echo ==============================
+echo Running Batch Queries
+echo ==============================
+
+echo Running batch_query...
+..\build\batch_query.exe
+
+echo ==============================
+echo ✅ Batch queries completed.
+echo ==============================
+pause
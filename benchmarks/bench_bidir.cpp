@@ -0,0 +1,117 @@
+// Bidirectional search benchmark: dijkstra_lazy vs dijkstra_bidir and astar_best (ALT) vs
+// astar_bidir_alt on the mains' source/target pair and on a fixed set of random pairs.
+// Reports time and settled nodes per query, and checks that all four agree on the distance
+// and return a valid s-t path of that length.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "../astar/astar_alt.h"
+#include "../astar/astar_bidir.h"
+#include "../astar/landmark_cache.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int RANDOM_QUERIES = 100;
+const int LANDMARKS = 8;
+
+struct Totals {
+    double time = 0;
+    long long settled = 0;
+};
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        CSRGraph32 R = directed ? reverse_graph(G) : G;
+        int n = G.size();
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, "
+             << (directed ? "directed" : "undirected") << ") ==\n";
+
+        LandmarkTables T = landmark_tables(G, directed, LANDMARKS, landmark_cache_path(input, LANDMARKS));
+        auto table = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+
+        vector<pair<int, int>> queries = {{source, n - 1}};
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        for (int i = 0; i < RANDOM_QUERIES; ++i)
+            queries.push_back({node(rng), node(rng)});
+
+        const vector<string> names = {"dijkstra_lazy", "dijkstra_bidir", "astar_best", "astar_bidir_alt"};
+        vector<Totals> totals(names.size());
+        size_t mismatches = 0, bad_paths = 0;
+        SearchWorkspace ws(n), bwd(n);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            auto [s, t] = queries[i];
+            MultiALT to_t(table, t);
+            auto to_s = reversed_alt(to_t, s);
+
+            // Each kernel runs uninstrumented in the reused workspaces for the time, then once more
+            // with counters for the settled nodes; the path is read from ws (fwd for the bidirectional ones)
+            vector<double> dist(names.size());
+            vector<Timer> timers(names.size());
+            vector<SearchCounters> counters(names.size());
+            vector<vector<int>> paths(names.size());
+            dist[0] = timed_then_counted(timers[0], [&](auto&& instr) {
+                return dijkstra_lazy(G, s, t, ws, instr); }, counters[0]);
+            paths[0] = ws.path(t);
+            dist[1] = timed_then_counted(timers[1], [&](auto&& instr) {
+                return dijkstra_bidir(G, R, s, t, ws, bwd, instr); }, counters[1]);
+            paths[1] = ws.path(t);
+            dist[2] = timed_then_counted(timers[2], [&](auto&& instr) {
+                return astar_best(G, s, t, to_t, ws, instr); }, counters[2]);
+            paths[2] = ws.path(t);
+            dist[3] = timed_then_counted(timers[3], [&](auto&& instr) {
+                return astar_bidir_alt(G, R, s, t, to_t, to_s, ws, bwd, instr); }, counters[3]);
+            paths[3] = ws.path(t);
+
+            for (size_t a = 1; a < names.size(); ++a) {
+                mismatches += (dist[a] != dist[0]);
+                if (dist[0] != INF) {
+                    const vector<int>& path = paths[a];
+                    bool valid = !path.empty() && path.front() == s && path.back() == t
+                                 && path_length(G, path) == dist[0];
+                    bad_paths += !valid;
+                }
+            }
+
+            if (i == 0) {
+                cout << "  main query " << s << " -> " << t << " (dist " << fixed << setprecision(0) << dist[0] << "):\n";
+                for (size_t a = 0; a < names.size(); ++a)
+                    cout << "    " << left << setw(16) << names[a] << right << setprecision(1) << setw(10)
+                         << timers[a].elapsed() * 1e6 << " us " << setw(8) << counters[a].settled << " settled\n";
+            } else {
+                for (size_t a = 0; a < names.size(); ++a) {
+                    totals[a].time += timers[a].elapsed();
+                    totals[a].settled += counters[a].settled;
+                }
+            }
+        }
+
+        cout << "  " << RANDOM_QUERIES << " random queries (mean per query):\n";
+        for (size_t a = 0; a < names.size(); ++a)
+            cout << "    " << left << setw(16) << names[a] << right << setprecision(1) << setw(10)
+                 << totals[a].time / RANDOM_QUERIES * 1e6 << " us " << setw(8)
+                 << totals[a].settled / RANDOM_QUERIES << " settled, "
+                 << setprecision(2) << double(totals[0].settled) / max<long long>(totals[a].settled, 1)
+                 << "x fewer than dijkstra_lazy\n";
+        cout << "  distance mismatches: " << mismatches << ", invalid paths: " << bad_paths << "\n";
+    }
+}
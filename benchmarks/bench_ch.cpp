@@ -0,0 +1,90 @@
+// Contraction Hierarchies benchmark: preprocessing cost, then CH queries against
+// dijkstra_lazy on the mains' source/target pair and on a fixed set of random pairs.
+// Checks that distances agree and that the unpacked CH path equals the Dijkstra path
+// (or, where the graph has equal-cost alternatives, is a valid path of the same length).
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../ch/ch.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int RANDOM_QUERIES = 100;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        int n = G.size();
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs) ==\n";
+
+        Timer build;
+        build.start();
+        ContractionHierarchy H = build_ch(G);
+        build.pause();
+        cout << "  preprocessing " << fixed << setprecision(2) << build.elapsed() << " s, "
+             << H.num_shortcuts() << " shortcuts\n";
+
+        vector<pair<int, int>> queries = {{source, n - 1}};
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        for (int i = 0; i < RANDOM_QUERIES; ++i)
+            queries.push_back({node(rng), node(rng)});
+
+        CHQuery query(H);
+        double ch_time = 0, dijk_time = 0;
+        size_t ch_edges = 0, dijk_edges = 0, mismatches = 0, ties = 0, bad_paths = 0;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            auto [s, t] = queries[i];
+
+            Timer dt;
+            vector<int> prev;
+            vector<pair<int, int>> explored;
+            double expected = dijkstra_lazy(G, s, t, explored, prev, &dt)[t];
+
+            vector<pair<int, int>> ch_explored;
+            Timer ct;
+            ct.start();
+            double got = query.distance(s, t, &ch_explored);
+            ct.pause();
+
+            mismatches += (got != expected);
+            if (expected != INF) {
+                vector<int> path = query.path();
+                if (path != reconstruct_path(prev, t)) {
+                    bool valid = path.front() == s && path.back() == t && path_length(G, path) == expected;
+                    (valid ? ties : bad_paths) += 1;
+                }
+            }
+            if (i == 0)
+                cout << "  main query " << s << " -> " << t << ": dist " << setprecision(0) << got
+                     << ", CH " << setprecision(1) << ct.elapsed() * 1e6 << " us (" << ch_explored.size()
+                     << " edges), dijkstra_lazy " << dt.elapsed() * 1e6 << " us (" << explored.size() << " edges)\n";
+            else {
+                ch_time += ct.elapsed();
+                dijk_time += dt.elapsed();
+                ch_edges += ch_explored.size();
+                dijk_edges += explored.size();
+            }
+        }
+        cout << "  " << RANDOM_QUERIES << " random queries: CH " << setprecision(1) << ch_time / RANDOM_QUERIES * 1e6
+             << " us/query (" << ch_edges / RANDOM_QUERIES << " edges), dijkstra_lazy "
+             << dijk_time / RANDOM_QUERIES * 1e6 << " us/query (" << dijk_edges / RANDOM_QUERIES << " edges), speedup "
+             << setprecision(0) << dijk_time / ch_time << "x\n";
+        cout << "  distance mismatches: " << mismatches << ", invalid paths: " << bad_paths
+             << ", equal-cost alternative paths: " << ties << "\n";
+    }
+}
@@ -0,0 +1,177 @@
+// Chain compression benchmark: every query kernel on the input graph and on its degree-2 compressed
+// core (graph_chains.h), for the same random pairs. On the core, queries whose endpoints are chain
+// interiors run on the per-query graph from ChainGraph::query, and CH answers through
+// ChainGraph::distance. Landmark tables and coordinates are permuted, not recomputed; the contraction
+// hierarchy is built on each graph (its build time is reported).
+// Reports graph sizes, best-of-REPEATS mean query time per kernel, nodes settled by dijk_lazy, and
+// checks that both graphs give the same distances and that every expanded path is a path of the
+// input graph with that length.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/geo_heuristic.h"
+#include "../helpers/graph_chains.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_decKey.h"
+#include "../dijkstra/dijk_Fib.h"
+#include "../dijkstra/dijk_generated.h"
+#include "../dijkstra/dijk_radix.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "../astar/astar_alt.h"
+#include "../astar/astar_bidir.h"
+#include "../astar/astar_weighted.h"
+#include "../astar/landmark_cache.h"
+#include "../ch/ch.h"
+#include "../batch/batch_engine.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int QUERIES = 100;
+const int REPEATS = 3;  // best-of, as in bench_graph_layout
+const int LANDMARKS = 16;
+
+// Per-graph heuristic data, in that graph's ids
+struct Setup {
+    shared_ptr<const LandmarkTable> table;
+    unique_ptr<GeoModel> geo;
+    WeightInfo info;
+};
+
+template <typename GraphT>
+double run_kernel(const string& k, const GraphT& G, const GraphT& R, int s, int t, const Setup& S,
+                  SearchWorkspace& ws, SearchWorkspace& bwd)
+{
+    if (k == "dijk_generated") return run_dijk_generated(G, s, t, ws);
+    if (k == "dijk_lazy") return dijkstra_lazy(G, s, t, ws);
+    if (k == "dijk_decKey") return dijkstra_dary(G, s, t, ws);
+    if (k == "dijk_Fib") return dijkstra_fib(G, s, t, ws);
+    if (k == "dijk_radix") return dijkstra_integer(G, s, t, S.info, ws);
+    if (k == "dijk_bidir") return dijkstra_bidir(G, R, s, t, ws, bwd);
+    if (k == "astar_alt") return astar_best(G, s, t, MultiALT(S.table, t), ws);
+    if (k == "astar_bidir_alt") {
+        MultiALT h_t(S.table, t);
+        return astar_bidir_alt(G, R, s, t, h_t, reversed_alt(h_t, s), ws, bwd);
+    }
+    if (!S.geo)
+        return INF;
+    const GeoModel& geo = *S.geo;
+    auto h = [&geo, t](int v) { return geo.bound(v, t); };
+    return astar_weighted(G, s, t, h, 1.5, ws);  // w = 1.5
+}
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+    const vector<string> kernels = {"dijk_generated", "dijk_lazy", "dijk_decKey", "dijk_Fib", "dijk_radix",
+                                    "dijk_bidir", "astar_alt", "astar_bidir_alt", "astar_weighted", "ch"};
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        int n = G.size();
+        vector<LatLon> coords = open_coords(input, "../map_data/graph_" + name + "_nodes.txt", n);
+        LandmarkTables T = landmark_tables(G, directed, LANDMARKS, landmark_cache_path(input, LANDMARKS));
+        vector<Query> queries = random_queries(n, QUERIES);
+
+        auto start = chrono::steady_clock::now();
+        ChainGraph32 C = compress_chains(G);
+        double compress_time = seconds_since(start);
+        cout << "== " << name << " (" << QUERIES << " random queries) ==\n";
+        cout << "  input: " << n << " nodes, " << G.num_edges() << " arcs\n";
+        cout << "  core:  " << C.core_size() << " nodes, " << C.core.num_edges() << " arcs, " << C.chains.size()
+             << " chains (" << fixed << setprecision(1) << double(n) / C.core_size() << "x fewer nodes), compressed in "
+             << compress_time * 1e3 << " ms\n";
+
+        Setup in, core;
+        in.table = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+        in.info = weight_info(G);
+        if (!coords.empty())
+            in.geo = make_unique<GeoModel>(G, coords);
+        for (auto& row : T.dist_from_L)
+            row = permute_values(row, C.order);
+        for (auto& row : T.dist_to_L)
+            row = permute_values(row, C.order);
+        core.table = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+        core.info = weight_info(C.core);
+        if (!coords.empty())  // scale from the input arcs: attach arcs are parts of chains
+            core.geo = make_unique<GeoModel>(permute_graph(G, C.order), permute_values(coords, C.order));
+
+        CSRGraph32 R = directed ? reverse_graph(G) : G;
+        CSRGraph32 core_R = reverse_graph(C.core);
+        start = chrono::steady_clock::now();
+        ContractionHierarchy H = build_ch(G);
+        double ch_build = seconds_since(start);
+        start = chrono::steady_clock::now();
+        ContractionHierarchy core_H = build_ch(C.core);
+        double core_ch_build = seconds_since(start);
+        cout << "  CH build " << setprecision(0) << ch_build * 1e3 << " ms -> " << core_ch_build * 1e3 << " ms\n";
+        CHQuery ch(H), core_ch(core_H);
+        SearchWorkspace ws(n), bwd(n);
+
+        auto run_input = [&](const string& k, int s, int t) {
+            if (k == "ch")
+                return ch.distance(s, t);
+            return run_kernel(k, G, R, s, t, in, ws, bwd);
+        };
+        auto run_core = [&](const string& k, int s, int t) {
+            s = C.order.to_new[s];
+            t = C.order.to_new[t];
+            if (k == "ch")
+                return C.distance(s, t, [&](int a, int b) { return core_ch.distance(a, b); });
+            return run_kernel(k, C.query(s, t), C.reverse_query(core_R, s, t), s, t, core, ws, bwd);
+        };
+
+        cout << "  kernel             input (us)    core (us)   speedup   mismatches\n";
+        for (const string& k : kernels) {
+            double best_in = INF, best_core = INF;
+            vector<double> d_in, d_core;
+            for (int r = 0; r < REPEATS; ++r) {
+                d_in.clear();
+                d_core.clear();
+                start = chrono::steady_clock::now();
+                for (const Query& q : queries)
+                    d_in.push_back(run_input(k, q.s, q.t));
+                best_in = min(best_in, seconds_since(start) / queries.size());
+                start = chrono::steady_clock::now();
+                for (const Query& q : queries)
+                    d_core.push_back(run_core(k, q.s, q.t));
+                best_core = min(best_core, seconds_since(start) / queries.size());
+            }
+            size_t mismatches = 0;
+            for (size_t i = 0; i < queries.size(); ++i)
+                mismatches += d_in[i] != d_core[i];
+            cout << "  " << left << setw(17) << k << right << setprecision(1) << setw(12) << best_in * 1e6
+                 << setw(13) << best_core * 1e6 << setprecision(2) << setw(9) << best_in / best_core << "x"
+                 << setw(13) << mismatches << "\n";
+        }
+
+        // Settled nodes and expanded paths, dijk_lazy
+        size_t settled_in = 0, settled_core = 0, bad_paths = 0;
+        for (const Query& q : queries) {
+            CountingInstrumentation a, b;
+            dijkstra_lazy(G, q.s, q.t, ws, a);
+            settled_in += a.counters.settled;
+            int s = C.order.to_new[q.s], t = C.order.to_new[q.t];
+            double d = dijkstra_lazy(C.query(s, t), s, t, ws, b);
+            settled_core += b.counters.settled;
+            if (d == INF)
+                continue;
+            vector<int> path = C.expand(ws.path(t));
+            bad_paths += path.front() != q.s || path.back() != q.t || path_length(G, path) != d;
+        }
+        cout << "  dijk_lazy settles " << settled_in / QUERIES << " -> " << settled_core / QUERIES
+             << " nodes per query, " << bad_paths << " bad expanded paths\n";
+    }
+}
@@ -0,0 +1,99 @@
+// Component index benchmark (graph_components.h): labelling time, component sizes, and what the
+// O(1) check saves on random queries. Without it every unreachable query exhausts the component of
+// s before the kernel returns INF; with it, pairs in different weak components, or strong components
+// in the wrong topological order, are answered at once. Reports how many of the unreachable pairs
+// the check catches, the query time on them with and without it, and the graph kept by
+// largest_component.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/graph_components.h"
+#include "../helpers/search_workspace.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "../astar/astar_alt.h"
+#include "../astar/landmark_cache.h"
+#include "../batch/batch_engine.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int QUERIES = 1000;
+const int LANDMARKS = 16;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        int n = G.size();
+        CSRGraph32 R = directed ? reverse_graph(G) : G;
+        LandmarkTables T = landmark_tables(G, directed, LANDMARKS, landmark_cache_path(input, LANDMARKS));
+        auto table = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, " << QUERIES
+             << " random queries) ==\n";
+
+        auto start = chrono::steady_clock::now();
+        vector<int> weak = weak_components(G);
+        double weak_time = seconds_since(start);
+        start = chrono::steady_clock::now();
+        ComponentIndex index = component_index(G, directed);
+        double index_time = seconds_since(start);
+        cout << "  " << index.summary() << "\n";
+        cout << "  labelling: weak " << fixed << setprecision(1) << weak_time * 1e3 << " ms, weak + strong "
+             << index_time * 1e3 << " ms\n";
+
+        NodeSubset kept = largest_component(index);
+        CSRGraph32 L = induced_graph(G, kept);
+        cout << "  largest_component: " << L.size() << " nodes, " << L.num_edges() << " arcs\n";
+
+        SearchWorkspace ws(n), bwd(n);
+        map<string, function<double(int, int)>> kernels = {
+            {"dijk_lazy", [&](int s, int t) { return dijkstra_lazy(G, s, t, ws); }},
+            {"dijk_bidir", [&](int s, int t) { return dijkstra_bidir(G, R, s, t, ws, bwd); }},
+            {"astar_alt", [&](int s, int t) { return astar_best(G, s, t, MultiALT(table, t), ws); }},
+        };
+
+        vector<Query> unreachable;
+        size_t caught = 0, wrong = 0;
+        for (const Query& q : random_queries(n, QUERIES)) {
+            double d = dijkstra_lazy(G, q.s, q.t, ws);
+            bool rejected = !index.may_reach(q.s, q.t);
+            wrong += rejected && d != INF;
+            if (d == INF) {
+                unreachable.push_back(q);
+                caught += rejected;
+            }
+        }
+        cout << "  " << unreachable.size() << " unreachable pairs, " << caught << " caught by the check, " << wrong
+             << " reachable pairs rejected\n";
+        if (unreachable.empty())
+            continue;
+
+        cout << "  kernel         unreachable query (us)   with check (us)\n";
+        for (const auto& [k, run] : kernels) {
+            start = chrono::steady_clock::now();
+            for (const Query& q : unreachable)
+                run(q.s, q.t);
+            double plain = seconds_since(start) / unreachable.size();
+            start = chrono::steady_clock::now();
+            for (const Query& q : unreachable)
+                if (index.may_reach(q.s, q.t))
+                    run(q.s, q.t);
+            double checked = seconds_since(start) / unreachable.size();
+            cout << "  " << left << setw(15) << k << right << setprecision(1) << setw(24) << plain * 1e6
+                 << setw(18) << checked * 1e6 << "\n";
+        }
+    }
+}
@@ -0,0 +1,137 @@
+// Customizable route planning benchmark (crp/crp.h). For several cell-size ladders: partition time,
+// cells and boundary nodes per level, then for two metrics on the same topology (the input meters and a
+// travel-time profile) the customization time, clique memory, best-of-REPEATS query latency against
+// dijkstra_lazy, mismatches and nodes settled. For comparison, the ALT landmark tables that would have
+// to be recomputed for the travel-time metric. The paths of the first ladder
+// (the build_overlay default) are checked too.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../astar/landmark_cache.h"
+#include "../crp/crp.h"
+#include "../batch/batch_engine.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int QUERIES = 200;
+const int REPEATS = 3;  // best-of, as in bench_graph_layout
+const int LANDMARKS = 16;
+
+// Same arcs, weights turned into travel times in tenths of a second: each arc gets a speed of 30 to
+// 120 km/h from a hash of its endpoints (a stand-in for road classes the edge files do not have)
+CSRGraph32 travel_time_graph(const CSRGraph32& G)
+{
+    const int speeds[] = {30, 50, 80, 100, 120};
+    vector<uint32_t> offsets(1, 0);
+    vector<CSREdge<float>> adj;
+    adj.reserve(G.num_edges());
+    for (int u = 0; u < G.size(); ++u) {
+        for (auto [v, w] : G[u]) {
+            uint32_t h = (static_cast<uint32_t>(min(u, v)) * 2654435761u) ^ static_cast<uint32_t>(max(u, v));
+            int kmh = speeds[(h >> 7) % 5];
+            adj.push_back({v, max(1.0f, roundf(36.0f * w / kmh))});
+        }
+        offsets.push_back(static_cast<uint32_t>(adj.size()));
+    }
+    return CSRGraph32(move(offsets), move(adj));
+}
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+    const vector<vector<int>> ladders = {{512, 4096, 32768}, {128, 1024, 8192}, {256, 4096}, {1024, 16384}};  // build_overlay default first
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        int n = G.size();
+        vector<LatLon> coords = open_coords(input, "../map_data/graph_" + name + "_nodes.txt", n);
+        vector<Query> queries = random_queries(n, QUERIES);
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, " << QUERIES
+             << " random queries, " << default_threads() << " threads) ==\n";
+
+        vector<pair<string, CSRGraph32>> metrics = {{"meters", G}, {"travel time", travel_time_graph(G)}};
+        SearchWorkspace ws(n);
+        vector<vector<double>> expected(metrics.size());
+        vector<double> dijk_time(metrics.size(), INF);
+        for (size_t m = 0; m < metrics.size(); ++m)
+            for (int r = 0; r < REPEATS; ++r) {
+                expected[m].clear();
+                auto start = chrono::steady_clock::now();
+                for (const Query& q : queries)
+                    expected[m].push_back(dijkstra_lazy(metrics[m].second, q.s, q.t, ws));
+                dijk_time[m] = min(dijk_time[m], seconds_since(start) / queries.size());
+            }
+
+        auto start = chrono::steady_clock::now();
+        landmark_tables(metrics[1].second, directed, LANDMARKS, "");
+        cout << "  ALT preprocessing for the travel-time metric (" << LANDMARKS << " landmarks): " << fixed
+             << setprecision(2) << seconds_since(start) << " s\n";
+        cout << "  dijk_lazy: " << setprecision(1) << dijk_time[0] * 1e6 << " us (meters), " << dijk_time[1] * 1e6
+             << " us (travel time)\n";
+
+        for (size_t k = 0; k < ladders.size(); ++k) {
+            start = chrono::steady_clock::now();
+            PartitionOverlay O = build_overlay(G, coords, ladders[k]);
+            double partition = seconds_since(start);
+            cout << "  cells {";
+            for (size_t i = 0; i < ladders[k].size(); ++i)
+                cout << (i ? ", " : "") << ladders[k][i];
+            cout << "}: partition " << setprecision(0) << partition * 1e3 << " ms;";
+            for (int l = 1; l <= O.levels(); ++l)
+                cout << " L" << l << " " << O.num_cells(l) << " cells / " << O.boundary[l - 1].size() << " boundary";
+            cout << "\n    metric        customize (s)   cliques (MB)   query (us)   vs dijk_lazy   settled   mismatches\n";
+
+            for (size_t m = 0; m < metrics.size(); ++m) {
+                const CSRGraph32& W = metrics[m].second;
+                start = chrono::steady_clock::now();
+                OverlayMetric M = customize(O, W);
+                double custom = seconds_since(start);
+                OverlayQuery query(O, W, M);
+                double best = INF;
+                vector<double> d;
+                size_t settled = 0;
+                for (int r = 0; r < REPEATS; ++r) {
+                    d.clear();
+                    settled = 0;
+                    start = chrono::steady_clock::now();
+                    for (const Query& q : queries) {
+                        d.push_back(query.distance(q.s, q.t));
+                        settled += query.settled();
+                    }
+                    best = min(best, seconds_since(start) / queries.size());
+                }
+                size_t mismatches = 0, bad_paths = 0;
+                for (size_t i = 0; i < queries.size(); ++i)
+                    mismatches += d[i] != expected[m][i];
+                if (k == 0)
+                    for (const Query& q : queries) {
+                        double dist = query.distance(q.s, q.t);
+                        if (dist == INF)
+                            continue;
+                        vector<int> path = query.path();
+                        bad_paths += path.front() != q.s || path.back() != q.t || path_length(W, path) != dist;
+                    }
+                cout << "    " << left << setw(14) << metrics[m].first << right << setprecision(2) << setw(13)
+                     << custom << setprecision(1) << setw(15) << M.memory_bytes() / 1e6 << setw(13) << best * 1e6
+                     << setw(14) << dijk_time[m] / best << "x" << setw(10) << settled / queries.size() << setw(13)
+                     << mismatches;
+                if (k == 0)
+                    cout << "   (" << bad_paths << " bad paths)";
+                cout << "\n";
+            }
+        }
+    }
+}
@@ -0,0 +1,109 @@
+// Delta-stepping benchmark: one-to-all searches with delta_stepping on 1 .. N threads, both relaxation
+// modes and three bucket widths, against the sequential one-to-all Dijkstra used for preprocessing
+// (dijkstra in astar_alt.h). Checks dist against it and prev against dijkstra_lazy's full tree, then
+// times landmark preprocessing (selection + tables, 16 landmarks) on 1 .. N threads.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_delta.h"
+#include "../astar/astar_alt.h"
+#include "../astar/landmark_cache.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int RANDOM_SOURCES = 4;
+const int LANDMARKS = 16;
+
+// 1, 2, 4, ... up to all cores (always including the core count itself)
+vector<int> thread_counts()
+{
+    vector<int> counts;
+    int max_threads = default_threads();
+    for (int th = 1; th < max_threads; th *= 2)
+        counts.push_back(th);
+    counts.push_back(max_threads);
+    return counts;
+}
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        int n = G.size();
+        double delta0 = suggest_delta(G);
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, suggested delta "
+             << delta0 << ") ==\n";
+
+        vector<int> sources = {source};
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        for (int i = 0; i < RANDOM_SOURCES; ++i)
+            sources.push_back(node(rng));
+
+        // Sequential references
+        vector<vector<double>> expected_dist;
+        vector<vector<int>> expected_prev;
+        double sequential = 0;
+        SearchWorkspace ws(n);
+        for (int s : sources) {
+            auto start = chrono::steady_clock::now();
+            expected_dist.push_back(dijkstra(G, s));
+            sequential += seconds_since(start);
+            dijkstra_lazy(G, s, -1, ws);  // no target: the full shortest-path tree
+            expected_prev.push_back(ws.predecessors());
+        }
+        sequential /= sources.size();
+        cout << "  sequential dijkstra: " << fixed << setprecision(2) << sequential * 1e3 << " ms per source\n";
+
+        cout << "  mode          delta   threads   ms/source   speedup   dist mismatches   prev mismatches\n";
+        for (Relaxation mode : {Relaxation::Atomic, Relaxation::ThreadLocal}) {
+            for (double delta : {delta0 / 4, delta0, delta0 * 4}) {
+                for (int threads : thread_counts()) {
+                    double total = 0;
+                    size_t dist_mis = 0, prev_mis = 0;
+                    for (size_t i = 0; i < sources.size(); ++i) {
+                        vector<int> prev;
+                        auto start = chrono::steady_clock::now();
+                        auto dist = delta_stepping(G, sources[i], delta, threads, mode, &prev);
+                        total += seconds_since(start);
+                        for (int v = 0; v < n; ++v) {
+                            dist_mis += dist[v] != expected_dist[i][v];
+                            prev_mis += prev[v] != expected_prev[i][v];
+                        }
+                    }
+                    double mean = total / sources.size();
+                    cout << "  " << left << setw(12) << (mode == Relaxation::Atomic ? "atomic" : "thread-local")
+                         << right << setprecision(0) << setw(7) << delta << setw(10) << threads << setprecision(2)
+                         << setw(12) << mean * 1e3 << setw(9) << sequential / mean << "x" << setw(18) << dist_mis
+                         << setw(18) << prev_mis << "\n";
+                }
+            }
+        }
+
+        bool directed = read_graph_header(input).directed;
+        cout << "  landmark preprocessing (" << LANDMARKS << " landmarks, not cached):\n";
+        double base = 0;
+        for (int threads : thread_counts()) {
+            auto start = chrono::steady_clock::now();
+            landmark_tables(G, directed, LANDMARKS, "", nullptr, threads);
+            double elapsed = seconds_since(start);
+            if (threads == 1)
+                base = elapsed;
+            cout << "    " << setw(3) << threads << " threads: " << setprecision(3) << elapsed << " s, "
+                 << setprecision(2) << base / elapsed << "x\n";
+        }
+    }
+}
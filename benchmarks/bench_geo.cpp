@@ -0,0 +1,106 @@
+// Geographic heuristic benchmark: weighted A* with h = 0, the haversine bound, the
+// equirectangular approximation and haversine calibrated without the edges under 5 m
+// (min_weight, not a proven bound), sweeping the weight w. For a fixed set of random queries
+// (plus the mains' pair) reports explored edges, query time and path suboptimality against
+// dijkstra_lazy (w = 1 must give 0 for the first three: they are consistent).
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../helpers/geo_heuristic.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../astar/astar_weighted.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int RANDOM_QUERIES = 100;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+    const vector<double> weights = {1.0, 1.1, 1.25, 1.5, 2.0, 3.0};
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        string nodes = "../map_data/graph_" + name + "_nodes.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        int n = G.size();
+        vector<LatLon> coords = open_coords(input, nodes, n);
+        if (coords.empty()) {
+            cout << "Skipping " << name << ": no coordinates (" << nodes << ")\n";
+            continue;
+        }
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs) ==\n";
+
+        Timer calib;
+        calib.start();
+        GeoModel haversine(G, coords, GeoMetric::Haversine);
+        calib.pause();
+        GeoModel equirect(G, coords, GeoMetric::Equirectangular);
+        GeoModel above_5m(G, coords, GeoMetric::Haversine, 5.0);
+        cout << "  scale: haversine " << fixed << setprecision(4) << haversine.scale() << ", equirectangular "
+             << equirect.scale() << " (cos_ref " << equirect.cos_ref() << "), haversine >= 5 m "
+             << above_5m.scale() << ", calibration "
+             << setprecision(3) << calib.elapsed() << " s\n";
+
+        // Reachable pairs only, so suboptimality is defined
+        vector<pair<int, int>> queries = {{source, n - 1}};
+        vector<double> optimal;
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        for (int i = 0; i < RANDOM_QUERIES; ++i)
+            queries.push_back({node(rng), node(rng)});
+        vector<pair<int, int>> reachable;
+        SearchWorkspace ws(n);
+        for (auto [s, t] : queries) {
+            double d = dijkstra_lazy(G, s, t, ws);
+            if (d != INF) {
+                reachable.push_back({s, t});
+                optimal.push_back(d);
+            }
+        }
+        cout << "  " << reachable.size() << " reachable queries\n";
+        cout << "  heuristic          w |  edges/query      us/query | subopt mean     max\n";
+
+        auto sweep = [&](const string& label, auto make_h) {
+            for (double w : weights) {
+                double time = 0, worst = 0, total = 0;
+                size_t edges = 0;
+                for (size_t i = 0; i < reachable.size(); ++i) {
+                    auto [s, t] = reachable[i];
+                    // Built untimed; the search runs uninstrumented in ws, edges from an untimed rerun
+                    auto h = make_h(t);
+                    Timer timer;
+                    SearchCounters counters;
+                    double d = timed_then_counted(timer, [&](auto&& instr) {
+                        return astar_weighted(G, s, t, h, w, ws, instr); }, counters);
+                    double sub = d / optimal[i] - 1;
+                    if (optimal[i] == 0)
+                        sub = 0;
+                    time += timer.elapsed();
+                    edges += counters.scanned;
+                    total += sub;
+                    worst = max(worst, sub);
+                }
+                size_t q = reachable.size();
+                cout << "  " << left << setw(16) << label << right << setprecision(2) << setw(5) << w << " | "
+                     << setw(12) << edges / q << setprecision(1) << setw(14) << time / q * 1e6 << " | "
+                     << setprecision(4) << setw(10) << total / q * 100 << "% " << setw(7) << worst * 100 << "%\n";
+            }
+        };
+        sweep("zero", [&](int) { return vector<double>(n, 0.0); });
+        sweep("haversine", [&](int t) { return GeoHeuristic(haversine, t); });
+        sweep("equirectangular", [&](int t) { return GeoHeuristic(equirect, t); });
+        sweep("haversine >=5 m", [&](int t) { return GeoHeuristic(above_5m, t); });
+    }
+}
@@ -0,0 +1,101 @@
+// Graph layout benchmark: runs every search kernel on the vector-of-vectors Graph,
+// the CSR graph and the CSR graph with 32-bit weights, from the same source/target
+// as the kernels' own mains, and reports the best-of-N query time per layout.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/csr_graph.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_decKey.h"
+#include "../dijkstra/dijk_Fib.h"
+#include "../dijkstra/dijk_generated.h"
+#include "../astar/astar_alt.h"
+#include "../astar/landmark_cache.h"
+#include "../astar/astar_weighted.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int REPEATS = 3;
+
+// Best-of-REPEATS query time of run(timer), which returns dist[t]
+template <typename Kernel>
+void report(const string& kernel, Kernel run)
+{
+    double best = INF, dist_t = INF;
+    for (int r = 0; r < REPEATS; ++r) {
+        Timer timer;
+        dist_t = run(&timer);
+        best = min(best, timer.elapsed());
+    }
+    cout << "    " << setw(16) << left << kernel << right
+         << " time " << setw(10) << fixed << setprecision(6) << best << " s"
+         << "   dist " << setprecision(0) << dist_t << "\n";
+}
+
+template <typename GraphT>
+void run_layout(const string& layout, const GraphT& G, bool directed, int s, int t, size_t bytes)
+{
+    cout << "  [" << layout << "] adjacency: " << bytes / (1024.0 * 1024.0) << " MB\n";
+
+    report("dijk_generated", [&](Timer* tm) {
+        vector<int> prev; vector<pair<int, int>> explored;
+        return run_dijk_generated(G, s, t, explored, prev, tm)[t];
+    });
+    report("dijk_lazy", [&](Timer* tm) {
+        vector<int> prev; vector<pair<int, int>> explored;
+        return dijkstra_lazy(G, s, t, explored, prev, tm)[t];
+    });
+    report("dijk_decKey", [&](Timer* tm) {
+        vector<int> prev; vector<pair<int, int>> explored;
+        return dijkstra_dec_key(G, s, t, explored, prev, tm)[t];
+    });
+    report("dijk_Fib", [&](Timer* tm) {
+        vector<int> prev; vector<pair<int, int>> explored;
+        return dijkstra_fib(G, s, t, explored, prev, tm)[t];
+    });
+
+    vector<double> h0(G.size(), 0.0);
+    report("astar_weighted", [&](Timer* tm) {
+        vector<int> prev; vector<pair<int, int>> explored;
+        return astar_weighted(G, s, t, h0, 1.5, explored, prev, tm)[t];
+    });
+
+    Timer pre;
+    pre.start();
+    LandmarkTables T = landmark_tables(G, directed, 8, "");  // no cache: time the preprocessing
+    MultiALT h(T.dist_from_L, T.dist_to_L, t);
+    pre.pause();
+    cout << "    landmark preprocessing " << fixed << setprecision(3) << pre.elapsed() << " s\n";
+    report("astar_alt", [&](Timer* tm) {
+        vector<int> prev; vector<pair<int, int>> explored;
+        return astar_best(G, s, t, h, explored, prev, tm)[t];
+    });
+}
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+
+        Graph G = read_graph(input);
+        CSRGraph C(G);
+        CSRGraph32 C32(G);
+        bool directed = read_graph_header(input).directed;
+        int s = source, t = G.size() - 1;
+        cout << "== " << name << " (" << G.size() << " nodes, " << C.num_edges() << " arcs) ==\n";
+
+        run_layout("vector<vector<Edge>>", G, directed, s, t, memory_bytes(G));
+        run_layout("CSRGraph", C, directed, s, t, C.memory_bytes());
+        run_layout("CSRGraph32", C32, directed, s, t, C32.memory_bytes());
+    }
+}
@@ -0,0 +1,211 @@
+// Heap micro-benchmark: records the push / decrease-key / pop sequence of full Dijkstra
+// searches on a real graph, then replays that exact trace on each priority queue:
+// MinBinaryHeap, DaryHeap (several arities, double and 32-bit keys), std::priority_queue
+// (decrease-key becomes a duplicate push, stale pops are skipped) and boost's Fibonacci heap.
+// Reports the best-of-N replay time and checks every queue pops the same key sequence.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/dary_heap.h"
+#include "../dijkstra/dijk_decKey.h"
+#include <boost/heap/fibonacci_heap.hpp>
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int SOURCES = 5;   // full searches recorded per graph
+const int REPEATS = 5;
+
+enum class OpType : uint8_t { Push, Decrease, Pop, Reset };
+struct Op {
+    OpType type;
+    int v;
+    double key;
+};
+
+// Dijkstra from each source over the whole graph, logging its heap operations
+template <typename GraphT>
+vector<Op> record_trace(const GraphT& G, const vector<int>& sources)
+{
+    int n = G.size();
+    vector<Op> trace;
+    for (int s : sources) {
+        vector<double> dist(n, INF);
+        DaryHeap<double> heap(n);
+        dist[s] = 0;
+        heap.push(s, 0);
+        trace.push_back({OpType::Push, s, 0});
+        while (!heap.empty()) {
+            int u = heap.pop().second;
+            trace.push_back({OpType::Pop, -1, 0});
+            for (auto [v, w] : G[u]) {
+                double nd = dist[u] + w;
+                if (nd < dist[v]) {
+                    bool queued = heap.contains(v) || dist[v] == INF;
+                    if (!queued)
+                        continue;  // already settled
+                    trace.push_back({dist[v] == INF ? OpType::Push : OpType::Decrease, v, nd});
+                    heap.push_or_decrease(v, nd);
+                    dist[v] = nd;
+                }
+            }
+        }
+        trace.push_back({OpType::Reset, -1, 0});
+    }
+    return trace;
+}
+
+// FNV-1a over the popped keys, to check that all queues agree
+struct KeyHash {
+    uint64_t h = 1469598103934665603ull;
+    void add(double k) {
+        uint64_t bits;
+        memcpy(&bits, &k, sizeof(bits));
+        h = (h ^ bits) * 1099511628211ull;
+    }
+};
+
+template <typename Key, int D>
+uint64_t replay_dary(const vector<Op>& trace, int n)
+{
+    DaryHeap<Key, D> heap(n);
+    KeyHash hash;
+    for (const Op& op : trace) {
+        switch (op.type) {
+        case OpType::Push: heap.push(op.v, static_cast<Key>(op.key)); break;
+        case OpType::Decrease: heap.decrease(op.v, static_cast<Key>(op.key)); break;
+        case OpType::Pop: hash.add(heap.pop().first); break;
+        case OpType::Reset: heap.clear(); break;
+        }
+    }
+    return hash.h;
+}
+
+uint64_t replay_binary(const vector<Op>& trace, int n)
+{
+    MinBinaryHeap heap(n);
+    KeyHash hash;
+    for (const Op& op : trace) {
+        switch (op.type) {
+        case OpType::Push: heap.push(op.v, op.key); break;
+        case OpType::Decrease: heap.decrease(op.v, op.key); break;
+        case OpType::Pop: hash.add(heap.pop().first); break;
+        case OpType::Reset: heap = MinBinaryHeap(n); break;
+        }
+    }
+    return hash.h;
+}
+
+uint64_t replay_std(const vector<Op>& trace, int n)
+{
+    using Node = pair<double, int>;
+    priority_queue<Node, vector<Node>, greater<Node>> heap;
+    vector<char> popped(n, 0);
+    KeyHash hash;
+    for (const Op& op : trace) {
+        switch (op.type) {
+        case OpType::Push:
+        case OpType::Decrease: heap.emplace(op.key, op.v); break;
+        case OpType::Pop:
+            while (popped[heap.top().second])
+                heap.pop();
+            popped[heap.top().second] = 1;
+            hash.add(heap.top().first);
+            heap.pop();
+            break;
+        case OpType::Reset:
+            heap = {};
+            fill(popped.begin(), popped.end(), 0);
+            break;
+        }
+    }
+    return hash.h;
+}
+
+uint64_t replay_fib(const vector<Op>& trace, int n)
+{
+    using Node = pair<double, int>;
+    using Fib = boost::heap::fibonacci_heap<Node, boost::heap::compare<greater<Node>>>;
+    Fib heap;
+    vector<Fib::handle_type> ref(n);
+    KeyHash hash;
+    for (const Op& op : trace) {
+        switch (op.type) {
+        case OpType::Push: ref[op.v] = heap.push({op.key, op.v}); break;
+        case OpType::Decrease: heap.update(ref[op.v], {op.key, op.v}); break;
+        case OpType::Pop: hash.add(heap.top().first); heap.pop(); break;
+        case OpType::Reset: heap.clear(); break;
+        }
+    }
+    return hash.h;
+}
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        int n = G.size();
+
+        vector<int> sources = {source};
+        mt19937 rng(42);
+        while ((int)sources.size() < SOURCES)
+            sources.push_back(uniform_int_distribution<int>(0, n - 1)(rng));
+        vector<Op> trace = record_trace(G, sources);
+        size_t pushes = 0, decreases = 0, pops = 0;
+        for (const Op& op : trace) {
+            pushes += op.type == OpType::Push;
+            decreases += op.type == OpType::Decrease;
+            pops += op.type == OpType::Pop;
+        }
+        cout << "== " << name << ": " << SOURCES << " full searches, " << pushes << " pushes, "
+             << decreases << " decreases, " << pops << " pops ==\n";
+
+        WeightInfo info = weight_info(G);
+        bool key32 = info.integral && uint64_t(n) * info.max_weight < UINT32_MAX;
+
+        vector<pair<string, function<uint64_t()>>> heaps = {
+            {"MinBinaryHeap", [&] { return replay_binary(trace, n); }},
+            {"DaryHeap<double,2>", [&] { return replay_dary<double, 2>(trace, n); }},
+            {"DaryHeap<double,4>", [&] { return replay_dary<double, 4>(trace, n); }},
+            {"DaryHeap<double,8>", [&] { return replay_dary<double, 8>(trace, n); }},
+            {"priority_queue", [&] { return replay_std(trace, n); }},
+            {"fibonacci_heap", [&] { return replay_fib(trace, n); }},
+        };
+        if (key32) {
+            heaps.push_back({"DaryHeap<uint32,4>", [&] { return replay_dary<uint32_t, 4>(trace, n); }});
+            heaps.push_back({"DaryHeap<uint32,8>", [&] { return replay_dary<uint32_t, 8>(trace, n); }});
+        }
+
+        double baseline = 0;
+        uint64_t expected = 0;
+        for (size_t i = 0; i < heaps.size(); ++i) {
+            double best = INF;
+            uint64_t hash = 0;
+            for (int r = 0; r < REPEATS; ++r) {
+                Timer timer;
+                timer.start();
+                hash = heaps[i].second();
+                timer.pause();
+                best = min(best, timer.elapsed());
+            }
+            if (i == 0) {
+                baseline = best;
+                expected = hash;
+            }
+            cout << "  " << left << setw(20) << heaps[i].first << right << fixed << setprecision(2)
+                 << setw(9) << best * 1e3 << " ms" << setw(8) << baseline / best << "x"
+                 << (hash == expected ? "" : "   POP SEQUENCE DIFFERS") << "\n";
+        }
+    }
+}
@@ -0,0 +1,136 @@
+// Hub label benchmark (hl/hub_labels.h): builds the labels in contraction order and in degree order,
+// then answers the same random queries by label merge-join, by dijkstra_lazy and by a CH query.
+// Reports build time, label size and index memory per order, save / load time of the label file,
+// best-of-REPEATS mean latency per method, distance mismatches against dijkstra_lazy, and the cost
+// of the label-guided path search (nodes settled, paths not matching the distance).
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../ch/ch.h"
+#include "../hl/hub_labels.h"
+#include "../batch/batch_engine.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int QUERIES = 1000;
+const int REPEATS = 3;  // best-of, as in bench_graph_layout
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        int n = G.size();
+        vector<Query> queries = random_queries(n, QUERIES);
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, " << QUERIES
+             << " random queries) ==\n";
+
+        ContractionHierarchy H = open_ch(G, input);
+        map<string, vector<int>> orders = {{"ch_order", ch_order(H)}, {"degree_order", degree_order(G)}};
+        map<string, HubLabels> labels;
+        cout << "  order          build (s)   hubs/label   max label   index (MB)\n";
+        for (auto& [o, order] : orders) {
+            auto start = chrono::steady_clock::now();
+            HubLabels L = build_hub_labels(G, directed, order);
+            double build = seconds_since(start);
+            uint64_t longest = 0;
+            for (int v = 0; v < n; ++v) {
+                longest = max(longest, L.out_offsets[v + 1] - L.out_offsets[v] - 1);
+                if (directed)
+                    longest = max(longest, L.in_offsets[v + 1] - L.in_offsets[v] - 1);
+            }
+            cout << "  " << left << setw(15) << o << right << fixed << setprecision(2) << setw(9) << build
+                 << setprecision(1) << setw(13) << L.average_label_size() << setw(12) << longest << setw(13)
+                 << L.memory_bytes() / 1e6 << "\n";
+            labels[o] = move(L);
+        }
+
+        // Persistence round trip of the contraction-order labels
+        string file = hl_path(input) + ".bench";
+        uint64_t checksum = graph_checksum(G);
+        auto start = chrono::steady_clock::now();
+        save_hub_labels(file, checksum, labels["ch_order"]);
+        double save_time = seconds_since(start);
+        HubLabels loaded;
+        start = chrono::steady_clock::now();
+        bool ok = load_hub_labels(file, checksum, n, directed, loaded);
+        double load_time = seconds_since(start);
+        remove(file.c_str());
+        cout << "  label file: save " << setprecision(0) << save_time * 1e3 << " ms, load " << load_time * 1e3
+             << " ms" << (ok && loaded.out.size() == labels["ch_order"].out.size() ? "" : " (load FAILED)") << "\n";
+
+        SearchWorkspace ws(n);
+        CHQuery ch(H);
+        map<string, function<double(int, int)>> methods = {
+            {"dijk_lazy", [&](int s, int t) { return dijkstra_lazy(G, s, t, ws); }},
+            {"ch", [&](int s, int t) { return ch.distance(s, t); }},
+            {"hl ch_order", [&](int s, int t) { return labels["ch_order"].distance(s, t); }},
+            {"hl degree_order", [&](int s, int t) { return labels["degree_order"].distance(s, t); }},
+        };
+        vector<double> expected;
+        for (const Query& q : queries)
+            expected.push_back(dijkstra_lazy(G, q.s, q.t, ws));
+
+        const vector<string> order_shown = {"dijk_lazy", "ch", "hl ch_order", "hl degree_order"};
+        double baseline = 0;
+        cout << "  method           query (us)   vs dijk_lazy   mismatches\n";
+        for (const string& m : order_shown) {
+            auto& run = methods[m];
+            double best = INF;
+            vector<double> d;
+            for (int r = 0; r < REPEATS; ++r) {
+                d.clear();
+                start = chrono::steady_clock::now();
+                for (const Query& q : queries)
+                    d.push_back(run(q.s, q.t));
+                best = min(best, seconds_since(start) / queries.size());
+            }
+            if (m == "dijk_lazy")
+                baseline = best;
+            size_t mismatches = 0;
+            for (size_t i = 0; i < queries.size(); ++i)
+                mismatches += d[i] != expected[i];
+            cout << "  " << left << setw(15) << m << right << setprecision(3) << setw(13) << best * 1e6
+                 << setprecision(0) << setw(14) << baseline / best << "x" << setw(13) << mismatches << "\n";
+        }
+
+        // Paths: label-guided A* against plain dijk_lazy
+        const HubLabels& L = labels["ch_order"];
+        size_t settled_dijk = 0, settled_hl = 0, bad_paths = 0, reachable = 0;
+        double dijk_time = 0, hl_time = 0;
+        for (const Query& q : queries) {
+            CountingInstrumentation a, b;
+            start = chrono::steady_clock::now();
+            dijkstra_lazy(G, q.s, q.t, ws, a);
+            dijk_time += seconds_since(start);
+            start = chrono::steady_clock::now();
+            double d = hub_label_search(G, L, q.s, q.t, ws, b);
+            hl_time += seconds_since(start);
+            settled_dijk += a.counters.settled;
+            settled_hl += b.counters.settled;
+            if (d == INF)
+                continue;
+            ++reachable;
+            vector<int> path = ws.path(q.t);
+            bad_paths += path.front() != q.s || path.back() != q.t || path_length(G, path) != d;
+        }
+        cout << "  path query: dijk_lazy " << setprecision(1) << dijk_time / QUERIES * 1e6 << " us, "
+             << settled_dijk / QUERIES << " settled; label-guided " << hl_time / QUERIES * 1e6 << " us, "
+             << settled_hl / QUERIES << " settled; " << bad_paths << " bad paths of " << reachable << "\n";
+    }
+}
@@ -0,0 +1,136 @@
+// Instrumentation benchmark: the same random queries through dijkstra_lazy, astar_best (ALT) and
+// dijkstra_bidir with each instrumentation policy on a reused workspace, against the pattern the
+// kernels used before (Timer paused around every prev write and logged edge). Wall clock per query;
+// "timer" is what a Timer around the call reports, i.e. what the mains used to print as kernel time.
+// Also prints the mean search counters per query.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "../astar/astar_alt.h"
+#include "../astar/landmark_cache.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int QUERIES = 100;
+const int LANDMARKS = 8;
+
+// Before: two clock reads around each relaxation and each logged edge
+class TimerPausingLog : public EdgeLog {
+public:
+    TimerPausingLog(vector<pair<int, int>>& out, Timer& timer) : EdgeLog(out), timer_(timer) {}
+
+    void relax(int v) {
+        timer_.pause();
+        EdgeLog::relax(v);
+        timer_.start();
+    }
+    void scan(int u, int v) {
+        timer_.pause();
+        EdgeLog::scan(u, v);
+        timer_.start();
+    }
+
+private:
+    Timer& timer_;
+};
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        CSRGraph32 R = directed ? reverse_graph(G) : G;
+        int n = G.size();
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, " << QUERIES
+             << " random queries) ==\n";
+
+        LandmarkTables T = landmark_tables(G, directed, LANDMARKS, landmark_cache_path(input, LANDMARKS));
+        auto table = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        vector<pair<int, int>> queries;
+        for (int i = 0; i < QUERIES; ++i)
+            queries.push_back({node(rng), node(rng)});
+
+        SearchWorkspace ws(n), bwd(n);
+        EdgeTrace trace(2 * G.num_edges());  // bidir scans each arc at most once per direction
+        vector<pair<int, int>> log;
+
+        // A kernel run with a given policy; returns dist(s, t)
+        auto kernel = [&](const string& k, int s, int t, auto&& instr) {
+            if (k == "dijk_lazy")
+                return dijkstra_lazy(G, s, t, ws, instr);
+            if (k == "astar_alt")
+                return astar_best(G, s, t, MultiALT(table, t), ws, instr);
+            return dijkstra_bidir(G, R, s, t, ws, bwd, instr);
+        };
+
+        cout << "  kernel       policy        wall (us)   timer (us)   overhead   mismatches\n";
+        for (string k : {"dijk_lazy", "astar_alt", "dijk_bidir"}) {
+            vector<double> expected;
+            SearchCounters total;
+            double base = 0;
+            for (string policy : {"none", "counting", "trace", "log", "timer-pausing"}) {
+                double wall = 0, timed = 0;
+                size_t mismatches = 0;
+                for (size_t i = 0; i < queries.size(); ++i) {
+                    auto [s, t] = queries[i];
+                    trace.clear();
+                    log.clear();
+                    Timer timer;
+                    CountingInstrumentation counting;
+                    auto start = chrono::steady_clock::now();
+                    timer.start();
+                    double d;
+                    if (policy == "none")
+                        d = kernel(k, s, t, NoInstrumentation());
+                    else if (policy == "counting")
+                        d = kernel(k, s, t, counting);
+                    else if (policy == "trace")
+                        d = kernel(k, s, t, trace);
+                    else if (policy == "log")
+                        d = kernel(k, s, t, EdgeLog(log));
+                    else
+                        d = kernel(k, s, t, TimerPausingLog(log, timer));
+                    timer.pause();
+                    wall += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+                    timed += timer.elapsed();
+                    if (policy == "none")
+                        expected.push_back(d);
+                    else
+                        mismatches += (d != expected[i]);
+                    if (policy == "counting")
+                        total += counting.counters;
+                }
+                wall /= queries.size();
+                timed /= queries.size();
+                if (policy == "none")
+                    base = wall;
+                cout << "  " << left << setw(13) << k << setw(14) << policy << right << fixed << setprecision(1)
+                     << setw(9) << wall * 1e6 << setw(13) << timed * 1e6 << setprecision(2) << setw(10)
+                     << wall / base << "x" << setw(12) << mismatches << "\n";
+            }
+            double q = queries.size();
+            cout << "  " << k << " per query: " << setprecision(0) << total.settled / q << " settled, "
+                 << total.scanned / q << " scanned, " << total.relaxed / q << " relaxed, " << total.pushes / q
+                 << " pushes, " << total.pops / q << " pops, " << total.stale_pops / q << " stale pops\n";
+        }
+    }
+}
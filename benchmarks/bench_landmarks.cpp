@@ -0,0 +1,104 @@
+// Active landmark benchmark: ALT (astar_best) with every landmark evaluated vs a per-query
+// subset of the best few (chosen at the source and optionally refreshed during the search),
+// for several stored landmark counts. Reports time and settled nodes per query over the mains'
+// source/target pair plus a fixed set of random pairs, and checks distances against dijkstra_lazy.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../astar/astar_alt.h"
+#include "../astar/landmark_cache.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int RANDOM_QUERIES = 100;
+
+struct Config {
+    int landmarks;
+    int active;    // 0 = all
+    int refresh;   // settled nodes between re-selections, 0 = never
+};
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+    const vector<Config> configs = {
+        {8, 0, 0}, {16, 0, 0}, {32, 0, 0},
+        {16, 2, 0}, {16, 4, 0}, {16, 4, 100},
+        {32, 2, 100}, {32, 3, 100}, {32, 4, 0}, {32, 4, 100}, {32, 4, 1000},
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        int n = G.size();
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs) ==\n";
+
+        vector<pair<int, int>> queries = {{source, n - 1}};
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        for (int i = 0; i < RANDOM_QUERIES; ++i)
+            queries.push_back({node(rng), node(rng)});
+
+        SearchWorkspace ws(n);
+        vector<double> expected;
+        for (auto [s, t] : queries)
+            expected.push_back(dijkstra_lazy(G, s, t, ws));
+
+        map<int, shared_ptr<const LandmarkTable>> tables;
+        for (const Config& c : configs) {
+            if (!tables.count(c.landmarks)) {
+                Timer pre;
+                pre.start();
+                LandmarkTables T = landmark_tables(G, directed, c.landmarks, "");
+                tables[c.landmarks] = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+                pre.pause();
+                cout << "  " << c.landmarks << " landmarks: preprocessing " << fixed << setprecision(2)
+                     << pre.elapsed() << " s\n";
+            }
+        }
+
+        cout << "  stored active refresh | main: us settled | random (mean): us settled | mismatches\n";
+        for (const Config& c : configs) {
+            double main_time = 0, time = 0;
+            long long main_settled = 0, settled = 0;
+            size_t mismatches = 0;
+            for (size_t i = 0; i < queries.size(); ++i) {
+                auto [s, t] = queries[i];
+                MultiALT h(tables[c.landmarks], t);
+                h.active_count = c.active;
+                h.refresh_interval = c.refresh;
+
+                // Timed uninstrumented in the reused workspace; settled nodes from an untimed rerun
+                Timer timer;
+                SearchCounters counters;
+                double d = timed_then_counted(timer, [&](auto&& instr) {
+                    return astar_best(G, s, t, h, ws, instr); }, counters);
+                mismatches += (d != expected[i]);
+                if (i == 0) {
+                    main_time = timer.elapsed();
+                    main_settled = counters.settled;
+                } else {
+                    time += timer.elapsed();
+                    settled += counters.settled;
+                }
+            }
+            cout << "  " << setw(6) << c.landmarks << setw(7) << (c.active ? to_string(c.active) : "all")
+                 << setw(8) << c.refresh << " | " << setprecision(1) << setw(8) << main_time * 1e6 << setw(8)
+                 << main_settled << " | " << setw(8) << time / RANDOM_QUERIES * 1e6 << setw(8)
+                 << settled / RANDOM_QUERIES << " | " << mismatches << "\n";
+        }
+    }
+}
@@ -0,0 +1,91 @@
+// Graph loading benchmark: text throughput (MB/s) of read_graph against
+// read_graph_parallel at 1..N threads, plus the memory-mapped binary loader.
+// Also checks that the parallel loader builds exactly the same adjacency, and
+// shows the adjacency size of the undirected and directed loading modes.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/csr_graph.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/graph_parallel_io.h"
+#include "../helpers/parallel.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+bool same_graph(const Graph& A, const Graph& B)
+{
+    if (A.size() != B.size())
+        return false;
+    for (size_t u = 0; u < A.size(); ++u) {
+        if (A[u].size() != B[u].size())
+            return false;
+        for (size_t i = 0; i < A[u].size(); ++i)
+            if (A[u][i].to != B[u][i].to || A[u][i].w != B[u][i].w)
+                return false;
+    }
+    return true;
+}
+
+template <typename Load>
+double time_load(Load load)
+{
+    Timer t;
+    t.start();
+    load();
+    t.pause();
+    return t.elapsed();
+}
+
+int main()
+{
+    vector<string> datasets = {"large", "Netherlands"};
+
+    for (const auto& name : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        ifstream probe(input, ios::binary | ios::ate);
+        if (!probe) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        double mb = probe.tellg() / (1024.0 * 1024.0);
+        cout << "== " << name << " (" << fixed << setprecision(2) << mb << " MB text) ==\n";
+
+        Graph reference;
+        double seq = time_load([&] { reference = read_graph(input); });
+        cout << "  read_graph                     " << setw(8) << setprecision(3) << seq * 1000 << " ms  "
+             << setw(8) << setprecision(1) << mb / seq << " MB/s\n";
+
+        CSRGraph32 und = read_csr_graph_parallel<float>(input, default_threads(), EdgeMode::Undirected);
+        CSRGraph32 dir = read_csr_graph_parallel<float>(input, default_threads(), EdgeMode::Directed);
+        cout << "  adjacency undirected " << und.num_edges() << " arcs (" << setprecision(2) << und.memory_bytes() / (1024.0 * 1024.0)
+             << " MB), directed " << dir.num_edges() << " arcs (" << dir.memory_bytes() / (1024.0 * 1024.0) << " MB)\n";
+
+        vector<int> thread_counts;
+        for (int threads = 1; threads < default_threads(); threads *= 2)
+            thread_counts.push_back(threads);
+        thread_counts.push_back(default_threads());
+
+        for (int threads : thread_counts) {
+            Graph G;
+            double par = time_load([&] { G = read_graph_parallel(input, threads); });
+            CSRGraph C;
+            double csr = time_load([&] { C = read_csr_graph_parallel(input, threads); });
+            cout << "  read_graph_parallel     (" << setw(2) << threads << "t) " << setw(8) << setprecision(3) << par * 1000
+                 << " ms  " << setw(8) << setprecision(1) << mb / par << " MB/s"
+                 << (same_graph(reference, G) ? "" : "   MISMATCH") << "\n";
+            cout << "  read_csr_graph_parallel (" << setw(2) << threads << "t) " << setw(8) << setprecision(3) << csr * 1000
+                 << " ms  " << setw(8) << setprecision(1) << mb / csr << " MB/s\n";
+        }
+
+        string bin = graph_bin_path(input);
+        if (graph_bin_up_to_date(input)) {
+            size_t edges = 0;
+            double mapped = time_load([&] { edges = load_graph_bin(bin).graph.num_edges(); });
+            cout << "  load_graph_bin (mmap)          " << setw(8) << setprecision(3) << mapped * 1000 << " ms  ("
+                 << edges << " arcs)\n";
+        } else {
+            cout << "  (no up-to-date " << bin << "; run convert_graph to include the binary loader)\n";
+        }
+    }
+}
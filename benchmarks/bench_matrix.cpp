@@ -0,0 +1,90 @@
+// Distance table benchmark: the CH bucket many-to-many algorithm against repeated one-to-one
+// searches (CHQuery, and dijkstra_lazy with a reused workspace) for square tables of growing size.
+// One-to-one times are measured on a sample of the pairs and scaled to the full table ("est").
+// Checks the table against both one-to-one searches on the sampled pairs.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../ch/ch.h"
+#include "../ch/ch_matrix.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const vector<int> SIZES = {10, 100, 1000};
+const size_t CH_SAMPLE = 2000;    // one-to-one CH queries timed per size
+const size_t DIJK_SAMPLE = 20;    // one-to-one Dijkstra queries timed per size
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        int n = G.size();
+        ContractionHierarchy H = open_ch(G, input);
+        cout << "== " << name << " (" << n << " nodes, " << H.num_shortcuts() << " shortcuts, "
+             << default_threads() << " threads) ==\n";
+        cout << "  size          table (s)   table, 1 thread (s)   CH 1:1 (s)   Dijkstra 1:1 (s)   mismatches\n";
+
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        CHQuery query(H);
+        SearchWorkspace ws(n);
+        for (int size : SIZES) {
+            vector<int> sources(size), targets(size);
+            for (int& v : sources) v = node(rng);
+            for (int& v : targets) v = node(rng);
+
+            Timer parallel, single;
+            parallel.start();
+            DistanceTable T = distance_table(H, sources, targets);
+            parallel.pause();
+            single.start();
+            distance_table(H, sources, targets, 1);
+            single.pause();
+
+            size_t pairs = (size_t)size * size, mismatches = 0;
+            vector<pair<size_t, size_t>> sample;
+            for (size_t k = 0; k < min(pairs, CH_SAMPLE); ++k)
+                sample.push_back(pairs <= CH_SAMPLE ? make_pair(k / size, k % size)
+                                                    : make_pair((size_t)node(rng) % size, (size_t)node(rng) % size));
+
+            Timer ch;
+            for (auto [i, j] : sample) {
+                ch.start();
+                double d = query.distance(sources[i], targets[j]);
+                ch.pause();
+                mismatches += (static_cast<float>(d) != T.at(i, j));
+            }
+
+            Timer dijk;
+            size_t dijk_runs = min(sample.size(), DIJK_SAMPLE);
+            for (size_t k = 0; k < dijk_runs; ++k) {
+                auto [i, j] = sample[k];
+                dijk.start();
+                double d = dijkstra_lazy(G, sources[i], targets[j], ws);
+                dijk.pause();
+                mismatches += (static_cast<float>(d) != T.at(i, j));
+            }
+
+            bool est = sample.size() < pairs;
+            cout << "  " << left << setw(12) << (to_string(size) + " x " + to_string(size)) << right << fixed
+                 << setprecision(3) << setw(11) << parallel.elapsed() << setw(22) << single.elapsed()
+                 << setw(13) << ch.elapsed() * pairs / sample.size() << setw(19)
+                 << dijk.elapsed() * pairs / dijk_runs << (dijk_runs < pairs ? " est" : "    ")
+                 << setw(9) << mismatches << (est ? "  (CH 1:1 est)" : "") << "\n";
+        }
+    }
+}
@@ -0,0 +1,88 @@
+// Priority queue benchmark: the comparison-heap Dijkstra variants (lazy binary heap,
+// decrease-key binary heap, Fibonacci heap) against the integer-key ones (radix heap,
+// Dial buckets) on the mains' source/target pair and a fixed set of random pairs.
+// Reports mean query time and checks that every variant returns dijkstra_lazy's distance.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_decKey.h"
+#include "../dijkstra/dijk_Fib.h"
+#include "../dijkstra/dijk_radix.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int RANDOM_QUERIES = 50;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        int n = G.size();
+        WeightInfo info = weight_info(G);
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, "
+             << (info.integral ? "integer" : "non-integer") << " weights, max " << info.max_weight << ") ==\n";
+        if (!info.integral) {
+            cout << "  integer-key variants do not apply\n";
+            continue;
+        }
+
+        vector<pair<int, int>> queries = {{source, n - 1}};
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        for (int i = 0; i < RANDOM_QUERIES; ++i)
+            queries.push_back({node(rng), node(rng)});
+
+        // Uninstrumented kernels in one reused workspace; the integer queues are built once and
+        // cleared by each search, so a row measures the queue, not allocation or edge logging
+        SearchWorkspace ws(n);
+        RadixHeap radix;
+        DialQueue dial(info.max_weight);
+        using Kernel = function<double(int, int)>;
+        const vector<pair<string, Kernel>> kernels = {
+            {"dijk_lazy", [&](int s, int t) { return dijkstra_lazy(G, s, t, ws); }},
+            {"dijk_decKey", [&](int s, int t) { return dijkstra_dary(G, s, t, ws); }},
+            {"dijk_Fib", [&](int s, int t) { return dijkstra_fib(G, s, t, ws); }},
+            {"dijk_radix", [&](int s, int t) { return dijkstra_bucket(G, s, t, radix, ws); }},
+            {"dijk_dial", [&](int s, int t) { return dijkstra_bucket(G, s, t, dial, ws); }},
+        };
+
+        vector<double> expected;
+        for (auto [s, t] : queries)
+            expected.push_back(kernels[0].second(s, t));
+
+        cout << "  kernel            main (us)   random mean (us)   vs lazy   mismatches\n";
+        double lazy_mean = 0;
+        for (const auto& [kname, run] : kernels) {
+            double main_time = 0, total = 0;
+            size_t mismatches = 0;
+            for (size_t i = 0; i < queries.size(); ++i) {
+                Timer tm;
+                tm.start();
+                double d = run(queries[i].first, queries[i].second);
+                tm.pause();
+                mismatches += (d != expected[i]);
+                (i == 0 ? main_time : total) += tm.elapsed();
+            }
+            double mean = total / RANDOM_QUERIES;
+            if (kname == "dijk_lazy")
+                lazy_mean = mean;
+            cout << "  " << left << setw(14) << kname << right << fixed << setprecision(1) << setw(12)
+                 << main_time * 1e6 << setw(19) << mean * 1e6 << setprecision(2) << setw(9)
+                 << lazy_mean / mean << "x" << setw(12) << mismatches << "\n";
+        }
+    }
+}
@@ -0,0 +1,164 @@
+// Node order benchmark: every query kernel on the graph as generated (OSM dictionary order), renumbered
+// along a Hilbert curve (needs coordinates) and renumbered by reverse Cuthill-McKee. Queries are the
+// same random pairs in original ids, translated with the NodeOrder; landmark tables and coordinates
+// are permuted rather than recomputed, the contraction hierarchy is rebuilt per order.
+// Reports the best-of-REPEATS mean query time per kernel and order and the speedup over the original
+// order, and checks that every order gives the same distances. "gap" is the mean |id(u) - id(v)| over
+// all arcs.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/geo_heuristic.h"
+#include "../helpers/graph_order.h"
+#include "../helpers/search_workspace.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_decKey.h"
+#include "../dijkstra/dijk_Fib.h"
+#include "../dijkstra/dijk_generated.h"
+#include "../dijkstra/dijk_radix.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "../astar/astar_alt.h"
+#include "../astar/astar_bidir.h"
+#include "../astar/astar_weighted.h"
+#include "../astar/landmark_cache.h"
+#include "../ch/ch.h"
+#include "../batch/batch_engine.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int QUERIES = 50;
+const int REPEATS = 3;  // best-of, as in bench_graph_layout
+const int LANDMARKS = 16;
+
+double mean_gap(const CSRGraph32& G)
+{
+    double total = 0;
+    for (int u = 0; u < G.size(); ++u)
+        for (auto [v, w] : G[u])
+            total += abs(u - v);
+    return G.num_edges() ? total / G.num_edges() : 0;
+}
+
+struct Layout {
+    string name;
+    NodeOrder order;
+    double build_time = 0;
+};
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+    const vector<string> kernels = {"dijk_generated", "dijk_lazy", "dijk_decKey", "dijk_Fib", "dijk_radix",
+                                    "dijk_bidir", "astar_alt", "astar_bidir_alt", "astar_weighted", "ch"};
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G0 = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        int n = G0.size();
+        WeightInfo info = weight_info(G0);
+        vector<LatLon> coords0 = open_coords(input, "../map_data/graph_" + name + "_nodes.txt", n);
+        LandmarkTables T0 = landmark_tables(G0, directed, LANDMARKS, landmark_cache_path(input, LANDMARKS));
+        vector<Query> queries = random_queries(n, QUERIES);
+        cout << "== " << name << " (" << n << " nodes, " << G0.num_edges() << " arcs, " << QUERIES
+             << " random queries) ==\n";
+
+        vector<Layout> layouts = {{"original", NodeOrder::identity(n)}};
+        if (!coords0.empty()) {
+            auto start = chrono::steady_clock::now();
+            layouts.push_back({"hilbert", hilbert_order(coords0)});
+            layouts.back().build_time = seconds_since(start);
+        }
+        auto start = chrono::steady_clock::now();
+        layouts.push_back({"rcm", rcm_order(G0)});
+        layouts.back().build_time = seconds_since(start);
+
+        map<string, vector<double>> times;      // kernel -> mean seconds per layout
+        map<string, vector<double>> reference;  // kernel -> distances on the original order
+        map<string, size_t> mismatches;
+        for (const Layout& layout : layouts) {
+            const NodeOrder& order = layout.order;
+            start = chrono::steady_clock::now();
+            CSRGraph32 G = permute_graph(G0, order);
+            double permute_time = seconds_since(start);
+            CSRGraph32 R = directed ? reverse_graph(G) : G;
+            vector<vector<float>> from, to;
+            for (const auto& row : T0.dist_from_L)
+                from.push_back(permute_values(row, order));
+            for (const auto& row : T0.dist_to_L)
+                to.push_back(permute_values(row, order));
+            auto table = make_shared<const LandmarkTable>(from, to);
+            unique_ptr<GeoModel> geo = coords0.empty() ? nullptr
+                                                       : make_unique<GeoModel>(G, permute_values(coords0, order));
+            ContractionHierarchy H = build_ch(G);
+            CHQuery ch(H);
+            SearchWorkspace ws(n), bwd(n);
+            cout << "  [" << layout.name << "] order " << fixed << setprecision(1) << layout.build_time * 1e3
+                 << " ms + permute " << permute_time * 1e3 << " ms, gap " << setprecision(0) << mean_gap(G) << "\n";
+
+            auto run = [&](const string& k, int s, int t) -> double {
+                if (k == "dijk_generated") return run_dijk_generated(G, s, t, ws);
+                if (k == "dijk_lazy") return dijkstra_lazy(G, s, t, ws);
+                if (k == "dijk_decKey") return dijkstra_dary(G, s, t, ws);
+                if (k == "dijk_Fib") return dijkstra_fib(G, s, t, ws);
+                if (k == "dijk_radix") return dijkstra_integer(G, s, t, info, ws);
+                if (k == "dijk_bidir") return dijkstra_bidir(G, R, s, t, ws, bwd);
+                if (k == "astar_alt") return astar_best(G, s, t, MultiALT(table, t), ws);
+                if (k == "astar_bidir_alt") {
+                    MultiALT h_t(table, t);
+                    return astar_bidir_alt(G, R, s, t, h_t, reversed_alt(h_t, s), ws, bwd);
+                }
+                if (k == "astar_weighted") {
+                    if (!geo)
+                        return INF;
+                    auto h = [&geo, t](int v) { return geo->bound(v, t); };
+                    return astar_weighted(G, s, t, h, 1.5, ws);  // w = 1.5
+                }
+                return ch.distance(s, t);
+            };
+
+            for (const string& k : kernels) {
+                vector<double> dist;
+                double best = INF;
+                for (int r = 0; r < REPEATS; ++r) {
+                    dist.clear();
+                    start = chrono::steady_clock::now();
+                    for (const Query& q : queries)
+                        dist.push_back(run(k, order.to_new[q.s], order.to_new[q.t]));
+                    best = min(best, seconds_since(start) / queries.size());
+                }
+                times[k].push_back(best);
+                if (layout.name == "original")
+                    reference[k] = dist;
+                else
+                    for (size_t i = 0; i < dist.size(); ++i)
+                        mismatches[k] += dist[i] != reference[k][i];
+            }
+        }
+
+        cout << "  kernel           ";
+        for (const Layout& layout : layouts)
+            cout << setw(14) << layout.name + " (us)";
+        for (size_t i = 1; i < layouts.size(); ++i)
+            cout << setw(12) << layouts[i].name;
+        cout << "   mismatches\n";
+        for (const string& k : kernels) {
+            cout << "  " << left << setw(17) << k << right << setprecision(1);
+            for (double t : times[k])
+                cout << setw(14) << t * 1e6;
+            cout << setprecision(2);
+            for (size_t i = 1; i < layouts.size(); ++i)
+                cout << setw(11) << times[k][0] / times[k][i] << "x";
+            cout << setw(13) << mismatches[k] << "\n";
+        }
+    }
+}
@@ -0,0 +1,314 @@
+// Benchmark harness: loads each graph (and its landmarks, hierarchy and coordinates) once, then runs
+// every query algorithm over reproducible query sets with warm-up and repeated trials.
+//   random     uniformly random pairs (seed 42, as in the batch engine)
+//   rank_<r>   Dijkstra-rank queries: from random sources, the target is the 2^r-th node a full
+//              Dijkstra settles, so r measures how far the query reaches regardless of the graph
+// Kernels run uninstrumented in a reused workspace; settled nodes come from one extra counting run per
+// query. A query's time is its median over the repetitions; reported are median / p95 over the set and
+// queries/s of the median repetition. Exact variants must all return dijkstra_lazy's distance;
+// inexact ones (weighted A*) report their mean excess instead. Results go to
+// statistics/bench_suite_<name>.csv and .json.
+//
+//   bench_suite [--reps N] [--queries N] [--perf]
+//      --perf adds hardware counters per query (perf_event_open, Linux only)
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/geo_heuristic.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../helpers/perf_counters.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_decKey.h"
+#include "../dijkstra/dijk_Fib.h"
+#include "../dijkstra/dijk_radix.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "../astar/astar_alt.h"
+#include "../astar/astar_bidir.h"
+#include "../astar/astar_weighted.h"
+#include "../astar/landmark_cache.h"
+#include "../ch/ch.h"
+#include "../batch/batch_engine.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int RANK_SOURCES = 20;   // queries per Dijkstra rank
+const int MIN_RANK = 6;        // 2^6 = 64 settled nodes
+const int WARMUP_QUERIES = 10;
+const int LANDMARKS = 16;
+
+struct Variant {
+    string name;
+    bool exact;
+    function<double(int, int)> run;                    // uninstrumented, timed
+    function<double(int, int, SearchCounters&)> count; // untimed, for the counters
+};
+
+// f(s, t, instr) runs one query with the given instrumentation policy
+template <typename F>
+Variant make_variant(const string& name, bool exact, F f)
+{
+    return {name, exact,
+            [f](int s, int t) { return f(s, t, NoInstrumentation()); },
+            [f](int s, int t, SearchCounters& c) {
+                CountingInstrumentation counting;
+                double d = f(s, t, counting);
+                c = counting.counters;
+                return d;
+            }};
+}
+
+struct QuerySet {
+    string name;
+    vector<Query> queries;
+};
+
+// Records the order in which a search settles nodes
+struct SettleOrder : NoInstrumentation {
+    vector<int>& order;
+    explicit SettleOrder(vector<int>& order) : order(order) {}
+    void settle(int u) { order.push_back(u); }
+};
+
+vector<QuerySet> make_query_sets(const CSRGraph32& G, int random_count, SearchWorkspace& ws)
+{
+    int n = G.size();
+    vector<QuerySet> sets = {{"random", random_queries(n, random_count)}};
+    int max_rank = 0;
+    while ((2 << max_rank) <= n)
+        ++max_rank;
+    for (int r = MIN_RANK; r <= max_rank; ++r)
+        sets.push_back({"rank_" + to_string(r), {}});
+
+    mt19937 rng(42);
+    uniform_int_distribution<int> node(0, n - 1);
+    vector<int> order;
+    for (int i = 0; i < RANK_SOURCES; ++i) {
+        int s = node(rng);
+        order.clear();
+        dijkstra_lazy(G, s, -1, ws, SettleOrder(order));  // no target: settles s's whole component
+        for (int r = MIN_RANK; r <= max_rank; ++r)
+            if ((size_t(1) << r) < order.size())
+                sets[1 + r - MIN_RANK].queries.push_back({s, order[size_t(1) << r]});
+    }
+    while (sets.size() > 1 && sets.back().queries.empty())  // ranks beyond every component
+        sets.pop_back();
+    return sets;
+}
+
+struct Row {
+    string set, variant;
+    bool exact;
+    size_t queries;
+    int reps;
+    double median, p95, qps, settled, excess;
+    size_t mismatches;
+    array<double, PerfCounters::EVENT_COUNT> perf;  // per query, -1 = not collected
+};
+
+void write_csv(const string& filename, const string& dataset, const vector<Row>& rows)
+{
+    ofstream out(filename);
+    out << "dataset,query_set,variant,exact,queries,repetitions,median_us,p95_us,queries_per_s,"
+           "mean_settled,mismatches,mean_excess";
+    for (int e = 0; e < PerfCounters::EVENT_COUNT; ++e)
+        out << "," << PerfCounters::name(e);
+    out << "\n";
+    for (const Row& r : rows) {
+        out << dataset << "," << r.set << "," << r.variant << "," << r.exact << "," << r.queries << ","
+            << r.reps << "," << r.median * 1e6 << "," << r.p95 * 1e6 << "," << r.qps << "," << r.settled
+            << "," << r.mismatches << "," << r.excess;
+        for (double v : r.perf) {
+            out << ",";
+            if (v >= 0)
+                out << v;
+        }
+        out << "\n";
+    }
+}
+
+void write_json(const string& filename, const string& dataset, int n, size_t arcs, const vector<Row>& rows)
+{
+    ofstream out(filename);
+    out << "{\n  \"dataset\": \"" << dataset << "\",\n  \"nodes\": " << n << ",\n  \"arcs\": " << arcs
+        << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const Row& r = rows[i];
+        out << "    {\"query_set\": \"" << r.set << "\", \"variant\": \"" << r.variant
+            << "\", \"exact\": " << (r.exact ? "true" : "false") << ", \"queries\": " << r.queries
+            << ", \"repetitions\": " << r.reps << ", \"median_us\": " << r.median * 1e6
+            << ", \"p95_us\": " << r.p95 * 1e6 << ", \"queries_per_s\": " << r.qps
+            << ", \"mean_settled\": " << r.settled << ", \"mismatches\": " << r.mismatches
+            << ", \"mean_excess\": " << r.excess;
+        for (int e = 0; e < PerfCounters::EVENT_COUNT; ++e)
+            if (r.perf[e] >= 0)
+                out << ", \"" << PerfCounters::name(e) << "\": " << r.perf[e];
+        out << "}" << (i + 1 < rows.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+int main(int argc, char** argv)
+{
+    int reps = 5, random_count = 100;
+    bool perf = false;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc)
+            reps = max(1, stoi(argv[++i]));
+        else if (arg == "--queries" && i + 1 < argc)
+            random_count = max(1, stoi(argv[++i]));
+        else if (arg == "--perf")
+            perf = true;
+        else {
+            cout << "usage: bench_suite [--reps N] [--queries N] [--perf]\n";
+            return 1;
+        }
+    }
+
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+
+        // Everything a variant needs, loaded once
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        CSRGraph32 R = directed ? reverse_graph(G) : G;
+        int n = G.size();
+        WeightInfo info = weight_info(G);
+        LandmarkTables T = landmark_tables(G, directed, LANDMARKS, landmark_cache_path(input, LANDMARKS));
+        auto table = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+        ContractionHierarchy H = open_ch(G, input);
+        vector<LatLon> coords = open_coords(input, "../map_data/graph_" + name + "_nodes.txt", n);
+        unique_ptr<GeoModel> geo = coords.empty() ? nullptr : make_unique<GeoModel>(G, std::move(coords));
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, " << reps
+             << " repetitions) ==\n";
+
+        SearchWorkspace ws(n), bwd(n);
+        CHQuery ch(H);
+        vector<Variant> variants = {
+            make_variant("dijk_lazy", true, [&](int s, int t, auto&& instr) {
+                return dijkstra_lazy(G, s, t, ws, instr); }),
+            make_variant("dijk_decKey", true, [&](int s, int t, auto&& instr) {
+                return dijkstra_dary(G, s, t, ws, instr); }),
+            make_variant("dijk_Fib", true, [&](int s, int t, auto&& instr) {
+                return dijkstra_fib(G, s, t, ws, instr); }),
+            make_variant("dijk_bidir", true, [&](int s, int t, auto&& instr) {
+                return dijkstra_bidir(G, R, s, t, ws, bwd, instr); }),
+            make_variant("astar_alt", true, [&](int s, int t, auto&& instr) {
+                MultiALT h(table, t);
+                h.active_count = 4;
+                h.refresh_interval = 100;
+                return astar_best(G, s, t, h, ws, instr); }),
+            make_variant("astar_bidir_alt", true, [&](int s, int t, auto&& instr) {
+                MultiALT h_t(table, t);
+                return astar_bidir_alt(G, R, s, t, h_t, reversed_alt(h_t, s), ws, bwd, instr); }),
+        };
+        if (info.integral)
+            variants.push_back(make_variant("dijk_radix", true, [&](int s, int t, auto&& instr) {
+                return dijkstra_integer(G, s, t, info, ws, instr); }));
+        if (geo)
+            variants.push_back(make_variant("astar_weighted", false, [&](int s, int t, auto&& instr) {
+                // Uncached straight-line bound, as in the batch engine: no O(n) cache per query
+                auto h = [&geo, t](int v) { return geo->bound(v, t); };
+                return astar_weighted(G, s, t, h, 1.5, ws, instr); }));  // w = 1.5
+        // CH has its own query object; settled nodes from CHQuery::settled()
+        variants.push_back({"ch", true,
+                            [&](int s, int t) { return ch.distance(s, t); },
+                            [&](int s, int t, SearchCounters& c) {
+                                double d = ch.distance(s, t);
+                                c = SearchCounters();
+                                c.settled = ch.settled();
+                                return d;
+                            }});
+
+        vector<QuerySet> sets = make_query_sets(G, random_count, ws);
+        PerfCounters counters;
+        if (perf && !counters.available())
+            cout << "  hardware counters unavailable (perf_event_open failed), continuing without\n";
+
+        vector<Row> rows;
+        for (const QuerySet& set : sets) {
+            const vector<Query>& queries = set.queries;
+            vector<double> reference(queries.size());
+            for (size_t i = 0; i < queries.size(); ++i)
+                reference[i] = dijkstra_lazy(G, queries[i].s, queries[i].t, ws);
+
+            cout << "  " << set.name << " (" << queries.size() << " queries)\n"
+                 << "    variant            median (us)    p95 (us)   queries/s   settled   mismatches\n";
+            for (const Variant& var : variants) {
+                Row row{set.name, var.name, var.exact, queries.size(), reps, 0, 0, 0, 0, 0, 0, {}};
+                row.perf.fill(-1);
+
+                double settled = 0, excess = 0;
+                for (size_t i = 0; i < queries.size(); ++i) {
+                    SearchCounters c;
+                    double d = var.count(queries[i].s, queries[i].t, c);
+                    settled += c.settled;
+                    if (var.exact)
+                        row.mismatches += (d != reference[i]);
+                    else if (reference[i] > 0 && reference[i] != INF)
+                        excess += d / reference[i] - 1;
+                }
+                row.settled = settled / queries.size();
+                row.excess = excess / queries.size();
+
+                for (size_t i = 0; i < queries.size() && i < WARMUP_QUERIES; ++i)
+                    var.run(queries[i].s, queries[i].t);
+
+                vector<vector<double>> times(queries.size(), vector<double>(reps));
+                vector<double> rep_totals(reps, 0);
+                counters.reset();
+                for (int rep = 0; rep < reps; ++rep)
+                    for (size_t i = 0; i < queries.size(); ++i) {
+                        if (perf)
+                            counters.start();
+                        auto start = chrono::steady_clock::now();
+                        var.run(queries[i].s, queries[i].t);
+                        times[i][rep] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+                        if (perf)
+                            counters.stop();
+                        rep_totals[rep] += times[i][rep];
+                    }
+
+                vector<double> per_query;
+                for (auto& t : times) {
+                    sort(t.begin(), t.end());
+                    per_query.push_back(t[t.size() / 2]);
+                }
+                sort(per_query.begin(), per_query.end());
+                sort(rep_totals.begin(), rep_totals.end());
+                row.median = percentile(per_query, 0.50);
+                row.p95 = percentile(per_query, 0.95);
+                row.qps = rep_totals[reps / 2] > 0 ? queries.size() / rep_totals[reps / 2] : 0;
+                if (perf)
+                    for (int e = 0; e < PerfCounters::EVENT_COUNT; ++e)
+                        if (counters.value(e) >= 0)
+                            row.perf[e] = double(counters.value(e)) / (queries.size() * reps);
+
+                cout << "    " << left << setw(17) << var.name << right << fixed << setprecision(1)
+                     << setw(14) << row.median * 1e6 << setw(12) << row.p95 * 1e6 << setprecision(0)
+                     << setw(12) << row.qps << setw(10) << row.settled << setw(13) << row.mismatches;
+                if (!var.exact)
+                    cout << setprecision(2) << "   (+" << row.excess * 100 << "% mean excess)";
+                cout << "\n";
+                rows.push_back(row);
+            }
+        }
+
+        string base = "../statistics/bench_suite_" + name;
+        write_csv(base + ".csv", name, rows);
+        write_json(base + ".json", name, n, G.num_edges(), rows);
+        cout << "  -> " << base << ".csv, " << base << ".json\n";
+    }
+}
@@ -0,0 +1,103 @@
+// Trace output benchmark: the explored edges of a one-to-all dijkstra_lazy (every arc is scanned once,
+// the largest trace a query can produce) written three ways:
+//   vector + write_edges   edges collected in memory (EdgeLog), written line by line afterwards
+//   stream, text           TraceWriter text format during the search (same file contents)
+//   stream, binary         TraceWriter delta/varint format during the search
+// Reports search + output time, the memory held for edges and the file size, and checks that
+// read_trace gives back exactly the collected edges. Temporary files are removed afterwards.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../helpers/trace_sink.h"
+#include "../dijkstra/dijk_lazy.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int SOURCES = 5;
+
+size_t file_size(const string& filename)
+{
+    ifstream in(filename, ios::binary | ios::ate);
+    return in ? static_cast<size_t>(in.tellg()) : 0;
+}
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        int n = G.size();
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs, one-to-all from "
+             << SOURCES << " sources) ==\n";
+
+        vector<int> sources = {source};
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        while ((int)sources.size() < SOURCES)
+            sources.push_back(node(rng));
+
+        SearchWorkspace ws(n);
+        string text_file = "../map_data/graph_" + name + "_bench_trace.txt";
+        string binary_file = "../map_data/graph_" + name + "_bench_trace.bin";
+        double vec_time = 0, text_time = 0, binary_time = 0;
+        size_t vec_memory = 0, text_size = 0, binary_size = 0, edges = 0, mismatches = 0;
+
+        // One-to-all searches (t = -1, no target), so every trace covers s's whole component
+        for (int s : sources) {
+            vector<pair<int, int>> explored;
+            auto start = chrono::steady_clock::now();
+            dijkstra_lazy(G, s, -1, ws, EdgeLog(explored));
+            write_edges(text_file, explored);
+            vec_time += seconds_since(start);
+            vec_memory = max(vec_memory, explored.capacity() * sizeof(explored[0]));
+            edges += explored.size();
+
+            start = chrono::steady_clock::now();
+            {
+                TraceWriter trace(text_file);
+                dijkstra_lazy(G, s, -1, ws, EdgeStream(trace));
+                trace.close();
+            }
+            text_time += seconds_since(start);
+            text_size += file_size(text_file);
+            mismatches += read_trace(text_file) != explored;
+
+            start = chrono::steady_clock::now();
+            {
+                TraceWriter trace(binary_file, TraceFormat::Binary);
+                dijkstra_lazy(G, s, -1, ws, EdgeStream(trace));
+                trace.close();
+            }
+            binary_time += seconds_since(start);
+            binary_size += file_size(binary_file);
+            mismatches += read_trace(binary_file) != explored;
+        }
+        remove(text_file.c_str());
+        remove(binary_file.c_str());
+
+        size_t stream_memory = (TraceWriter::MAX_PENDING + 2) * TraceWriter::CHUNK;  // at most, any search size
+        cout << "  " << edges / SOURCES << " edges per trace, " << mismatches << " read_trace mismatches\n";
+        cout << "  output                 time (ms)   edge memory (KB)   file (KB)   bytes/edge\n";
+        auto row = [&](const string& label, double time, size_t memory, size_t bytes) {
+            cout << "  " << left << setw(22) << label << right << fixed << setprecision(1) << setw(10)
+                 << time / SOURCES * 1e3 << setw(19) << memory / 1024 << setw(12) << bytes / SOURCES / 1024
+                 << setprecision(2) << setw(13) << double(bytes) / edges << "\n";
+        };
+        row("vector + write_edges", vec_time, vec_memory, text_size);
+        row("stream, text", text_time, stream_memory, text_size);
+        row("stream, binary", binary_time, stream_memory, binary_size);
+    }
+}
@@ -0,0 +1,128 @@
+// Search workspace benchmark: per-query allocation (classic kernel signatures) against one
+// SearchWorkspace reused across queries, for dijkstra_lazy, astar_best (ALT) and dijkstra_bidir.
+// Short queries are where the O(n) setup dominates, so targets are taken a few hundred settled
+// nodes away from random sources, plus fully random pairs. Times are wall clock per query,
+// including setup; checks that both variants return the same distance.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/search_workspace.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "../astar/astar_alt.h"
+#include "../astar/landmark_cache.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int RANDOM_QUERIES = 200;
+const int LOCAL_RADIUS = 300;  // settled nodes between source and target of a short query
+const int LANDMARKS = 8;
+
+// The node settled LOCAL_RADIUS-th by a Dijkstra from s (or the last one, if fewer are reachable)
+template <typename GraphT>
+int nearby_target(const GraphT& G, int s, SearchWorkspace& ws)
+{
+    ws.begin(G.size());
+    auto& pq = ws.queue;
+    greater<SearchWorkspace::QueueEntry> later;
+    ws.set_dist(s, 0);
+    pq.emplace_back(0, s);
+    int last = s, settled = 0;
+    while (!pq.empty() && settled < LOCAL_RADIUS) {
+        pop_heap(pq.begin(), pq.end(), later);
+        auto [d, u] = pq.back();
+        pq.pop_back();
+        if (ws.settled(u))
+            continue;
+        ws.settle(u);
+        last = u;
+        ++settled;
+        for (auto [v, w] : G[u])
+            if (!ws.settled(v) && d + w < ws.dist(v)) {
+                ws.set_dist(v, d + w);
+                pq.emplace_back(d + w, v);
+                push_heap(pq.begin(), pq.end(), later);
+            }
+    }
+    return last;
+}
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);
+        bool directed = read_graph_header(input).directed;
+        CSRGraph32 R = directed ? reverse_graph(G) : G;
+        int n = G.size();
+        cout << "== " << name << " (" << n << " nodes, " << G.num_edges() << " arcs) ==\n";
+
+        LandmarkTables T = landmark_tables(G, directed, LANDMARKS, landmark_cache_path(input, LANDMARKS));
+        auto table = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+
+        mt19937 rng(42);
+        uniform_int_distribution<int> node(0, n - 1);
+        SearchWorkspace ws(n), bwd(n);
+        vector<pair<int, int>> local, random;
+        for (int i = 0; i < RANDOM_QUERIES; ++i) {
+            int s = node(rng);
+            local.push_back({s, nearby_target(G, s, ws)});
+            random.push_back({node(rng), node(rng)});
+        }
+
+        // Each kernel as (classic, reused workspace); both return dist(s, t)
+        using Kernel = function<double(int, int)>;
+        struct Variant { string name; Kernel classic, reused; };
+        const vector<Variant> variants = {
+            {"dijk_lazy",
+             [&](int s, int t) { Timer tm; vector<int> prev; vector<pair<int, int>> ex;
+                                 return dijkstra_lazy(G, s, t, ex, prev, &tm)[t]; },
+             [&](int s, int t) { vector<pair<int, int>> ex;
+                                 return dijkstra_lazy(G, s, t, ws, EdgeLog(ex)); }},
+            {"astar_alt",
+             [&](int s, int t) { Timer tm; vector<int> prev; vector<pair<int, int>> ex;
+                                 return astar_best(G, s, t, MultiALT(table, t), ex, prev, &tm)[t]; },
+             [&](int s, int t) { vector<pair<int, int>> ex;
+                                 return astar_best(G, s, t, MultiALT(table, t), ws, EdgeLog(ex)); }},
+            {"dijk_bidir",
+             [&](int s, int t) { Timer tm; vector<int> prev; vector<pair<int, int>> ex;
+                                 return dijkstra_bidir(G, R, s, t, ex, prev, &tm)[t]; },
+             [&](int s, int t) { vector<pair<int, int>> ex;
+                                 return dijkstra_bidir(G, R, s, t, ws, bwd, EdgeLog(ex)); }},
+        };
+
+        cout << "  kernel        queries   classic (us)   reused (us)   speedup   mismatches\n";
+        for (const auto& [label, queries] : {make_pair(string("short"), local), make_pair(string("random"), random)}) {
+            for (const auto& var : variants) {
+                double classic = 0, reused = 0;
+                size_t mismatches = 0;
+                for (auto [s, t] : queries) {
+                    auto t0 = chrono::steady_clock::now();
+                    double a = var.classic(s, t);
+                    auto t1 = chrono::steady_clock::now();
+                    double b = var.reused(s, t);
+                    auto t2 = chrono::steady_clock::now();
+                    classic += chrono::duration<double>(t1 - t0).count();
+                    reused += chrono::duration<double>(t2 - t1).count();
+                    mismatches += (a != b);
+                }
+                classic /= queries.size();
+                reused /= queries.size();
+                cout << "  " << left << setw(12) << var.name << setw(8) << label << right << fixed
+                     << setprecision(1) << setw(15) << classic * 1e6 << setw(14) << reused * 1e6
+                     << setprecision(2) << setw(9) << classic / reused << "x" << setw(12) << mismatches << "\n";
+            }
+        }
+    }
+}
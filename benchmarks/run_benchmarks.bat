@@ -0,0 +1,167 @@
+@echo off
+echo ==============================
+echo Compiling Benchmarks
+echo ==============================
+
+REM Create build and statistics folders if not existing
+if not exist ..\build mkdir ..\build
+if not exist ..\statistics mkdir ..\statistics
+
+echo [1/19] Compiling bench_graph_layout...
+g++ -std=c++17 -O2 -I..\helpers -I..\vcpkg\installed\x64-windows\include bench_graph_layout.cpp ..\helpers\timer.cpp -o ..\build\bench_graph_layout.exe
+
+echo [2/19] Compiling bench_load...
+g++ -std=c++17 -O2 -I..\helpers bench_load.cpp ..\helpers\timer.cpp -o ..\build\bench_load.exe
+
+echo [3/19] Compiling bench_ch...
+g++ -std=c++17 -O2 -I..\helpers bench_ch.cpp ..\helpers\timer.cpp -o ..\build\bench_ch.exe
+
+echo [4/19] Compiling bench_bidir...
+g++ -std=c++17 -O2 -I..\helpers bench_bidir.cpp ..\helpers\timer.cpp -o ..\build\bench_bidir.exe
+
+echo [5/19] Compiling bench_landmarks...
+g++ -std=c++17 -O2 -I..\helpers bench_landmarks.cpp ..\helpers\timer.cpp -o ..\build\bench_landmarks.exe
+
+echo [6/19] Compiling bench_geo...
+g++ -std=c++17 -O2 -I..\helpers bench_geo.cpp ..\helpers\timer.cpp -o ..\build\bench_geo.exe
+
+echo [7/19] Compiling bench_queues...
+g++ -std=c++17 -O2 -I..\helpers -I..\vcpkg\installed\x64-windows\include bench_queues.cpp ..\helpers\timer.cpp -o ..\build\bench_queues.exe
+
+echo [8/19] Compiling bench_heaps...
+g++ -std=c++17 -O2 -I..\helpers -I..\vcpkg\installed\x64-windows\include bench_heaps.cpp ..\helpers\timer.cpp -o ..\build\bench_heaps.exe
+
+echo [9/19] Compiling bench_workspace...
+g++ -std=c++17 -O2 -I..\helpers bench_workspace.cpp ..\helpers\timer.cpp -o ..\build\bench_workspace.exe
+
+echo [10/19] Compiling bench_matrix...
+g++ -std=c++17 -O2 -I..\helpers bench_matrix.cpp ..\helpers\timer.cpp -o ..\build\bench_matrix.exe
+
+echo [11/19] Compiling bench_delta...
+g++ -std=c++17 -O2 -I..\helpers bench_delta.cpp ..\helpers\timer.cpp -o ..\build\bench_delta.exe
+
+echo [12/19] Compiling bench_instrumentation...
+g++ -std=c++17 -O2 -I..\helpers bench_instrumentation.cpp ..\helpers\timer.cpp -o ..\build\bench_instrumentation.exe
+
+echo [13/19] Compiling bench_suite...
+g++ -std=c++17 -O2 -I..\helpers bench_suite.cpp ..\helpers\timer.cpp -o ..\build\bench_suite.exe
+
+echo [14/19] Compiling bench_trace...
+g++ -std=c++17 -O2 -I..\helpers bench_trace.cpp ..\helpers\timer.cpp -o ..\build\bench_trace.exe
+
+echo [15/19] Compiling bench_reorder...
+g++ -std=c++17 -O2 -I..\helpers bench_reorder.cpp ..\helpers\timer.cpp -o ..\build\bench_reorder.exe
+
+echo [16/19] Compiling bench_chains...
+g++ -std=c++17 -O2 -I..\helpers bench_chains.cpp ..\helpers\timer.cpp -o ..\build\bench_chains.exe
+
+echo [17/19] Compiling bench_components...
+g++ -std=c++17 -O2 -I..\helpers bench_components.cpp ..\helpers\timer.cpp -o ..\build\bench_components.exe
+
+echo [18/19] Compiling bench_hl...
+g++ -std=c++17 -O2 -I..\helpers bench_hl.cpp ..\helpers\timer.cpp -o ..\build\bench_hl.exe
+
+echo [19/19] Compiling bench_crp...
+g++ -std=c++17 -O2 -I..\helpers bench_crp.cpp ..\helpers\timer.cpp -o ..\build\bench_crp.exe
+
+echo ==============================
+echo Running Benchmarks
+echo ==============================
+
+echo Running bench_graph_layout...
+..\build\bench_graph_layout.exe
+
+echo ==============================
+
+echo Running bench_load...
+..\build\bench_load.exe
+
+echo ==============================
+
+echo Running bench_ch...
+..\build\bench_ch.exe
+
+echo ==============================
+
+echo Running bench_bidir...
+..\build\bench_bidir.exe
+
+echo ==============================
+
+echo Running bench_landmarks...
+..\build\bench_landmarks.exe
+
+echo ==============================
+
+echo Running bench_geo...
+..\build\bench_geo.exe
+
+echo ==============================
+
+echo Running bench_queues...
+..\build\bench_queues.exe
+
+echo ==============================
+
+echo Running bench_heaps...
+..\build\bench_heaps.exe
+
+echo ==============================
+
+echo Running bench_workspace...
+..\build\bench_workspace.exe
+
+echo ==============================
+
+echo Running bench_matrix...
+..\build\bench_matrix.exe
+
+echo ==============================
+
+echo Running bench_delta...
+..\build\bench_delta.exe
+
+echo ==============================
+
+echo Running bench_instrumentation...
+..\build\bench_instrumentation.exe
+
+echo ==============================
+
+echo Running bench_suite...
+..\build\bench_suite.exe
+
+echo ==============================
+
+echo Running bench_trace...
+..\build\bench_trace.exe
+
+echo ==============================
+
+echo Running bench_reorder...
+..\build\bench_reorder.exe
+
+echo ==============================
+
+echo Running bench_chains...
+..\build\bench_chains.exe
+
+echo ==============================
+
+echo Running bench_components...
+..\build\bench_components.exe
+
+echo ==============================
+
+echo Running bench_hl...
+..\build\bench_hl.exe
+
+echo ==============================
+
+echo Running bench_crp...
+..\build\bench_crp.exe
+
+echo ==============================
+echo ✅ All benchmarks completed.
+echo ==============================
+pause
@@ -0,0 +1,502 @@
+//Contraction Hierarchies: contracts nodes in order of importance (edge difference + contracted neighbours),
+//adding shortcuts that preserve shortest paths, so a query only searches upward from s and t.
+#ifndef CH_H
+#define CH_H
+
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include <vector>
+#include <queue>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// Edge of the CH search graphs; mid is the node a shortcut bypasses, -1 for an original edge
+struct CHEdge {
+    int to;
+    int mid;
+    double w;
+};
+
+struct ContractionHierarchy {
+    std::vector<int> rank;                // contraction position: higher = more important
+    std::vector<uint32_t> up_offsets;     // up[u]: u -> to with rank[to] > rank[u]
+    std::vector<CHEdge> up;
+    std::vector<uint32_t> down_offsets;   // down[v]: to -> v with rank[to] > rank[v]
+    std::vector<CHEdge> down;
+
+    int size() const { return static_cast<int>(rank.size()); }
+
+    size_t num_shortcuts() const {
+        size_t count = 0;
+        for (const auto& e : up) count += e.mid != -1;
+        for (const auto& e : down) count += e.mid != -1;
+        return count;
+    }
+};
+
+// Builds a hierarchy by repeatedly contracting the node with the lowest priority
+class CHBuilder
+{
+public:
+    template <typename GraphT>
+    explicit CHBuilder(const GraphT &G)
+        : n(G.size()), out(n), in(n), contracted(n, 0), deleted_neighbors(n, 0),
+          prio(n, 0), wdist(n, INF), up_edges(n), down_edges(n)
+    {
+        for (int u = 0; u < n; ++u)
+            for (auto [v, w] : G[u])
+                if (u != v)
+                    add_arc(u, v, w, -1);
+    }
+
+    ContractionHierarchy build()
+    {
+        using P = std::pair<int, int>; // (priority, node)
+        std::priority_queue<P, std::vector<P>, std::greater<P>> pq;
+        for (int v = 0; v < n; ++v)
+        {
+            prio[v] = priority(v);
+            pq.emplace(prio[v], v);
+        }
+
+        ContractionHierarchy H;
+        H.rank.assign(n, -1);
+        int next_rank = 0;
+        while (!pq.empty())
+        {
+            auto [p, v] = pq.top();
+            pq.pop();
+            if (contracted[v] || p != prio[v])
+                continue;
+            // Lazy update: re-evaluate, and postpone v if it is no longer the minimum
+            prio[v] = priority(v);
+            if (!pq.empty() && prio[v] > pq.top().first)
+            {
+                pq.emplace(prio[v], v);
+                continue;
+            }
+            H.rank[v] = next_rank++;
+            std::vector<int> neighbors = contract(v);
+            for (int x : neighbors)
+            {
+                ++deleted_neighbors[x];
+                prio[x] = priority(x);
+                pq.emplace(prio[x], x);
+            }
+        }
+
+        pack(up_edges, H.up_offsets, H.up);
+        pack(down_edges, H.down_offsets, H.down);
+        return H;
+    }
+
+private:
+    struct Shortcut {
+        int from, to;
+        double w;
+    };
+
+    // Settled-node budgets of one witness search; a miss only costs an extra shortcut,
+    // so priority estimates use a much smaller budget than the real contraction
+    static constexpr int ESTIMATE_LIMIT = 20;
+    static constexpr int CONTRACT_LIMIT = 500;
+
+    int n;
+    std::vector<std::vector<CHEdge>> out, in; // remaining graph
+    std::vector<char> contracted;
+    std::vector<int> deleted_neighbors, prio;
+    std::vector<double> wdist;
+    std::vector<int> touched;
+    std::vector<std::pair<double, int>> wheap;
+    std::vector<std::vector<CHEdge>> up_edges, down_edges;
+    std::vector<Shortcut> shortcuts;
+
+    // Insert u -> v, or lower the weight of an existing u -> v arc
+    void add_arc(int u, int v, double w, int mid)
+    {
+        for (auto &e : out[u])
+            if (e.to == v)
+            {
+                if (w < e.w)
+                {
+                    e.w = w;
+                    e.mid = mid;
+                    for (auto &r : in[v])
+                        if (r.to == u)
+                            r.w = w, r.mid = mid;
+                }
+                return;
+            }
+        out[u].push_back({v, mid, w});
+        in[v].push_back({u, mid, w});
+    }
+
+    static void remove_arc(std::vector<CHEdge> &edges, int to)
+    {
+        for (size_t i = 0; i < edges.size(); ++i)
+            if (edges[i].to == to)
+            {
+                edges[i] = edges.back();
+                edges.pop_back();
+                return;
+            }
+    }
+
+    // Bounded Dijkstra from s in the remaining graph, never passing through `skip`
+    void witness_search(int s, int skip, double limit, int max_settled)
+    {
+        for (int x : touched)
+            wdist[x] = INF;
+        touched.clear();
+        auto &pq = wheap;
+        pq.clear();
+        wdist[s] = 0;
+        touched.push_back(s);
+        pq.emplace_back(0, s);
+        int settled = 0;
+        while (!pq.empty() && settled < max_settled)
+        {
+            std::pop_heap(pq.begin(), pq.end(), std::greater<>());
+            auto [d, u] = pq.back();
+            pq.pop_back();
+            if (d > wdist[u])
+                continue;
+            if (d > limit)
+                break;
+            ++settled;
+            for (const auto &e : out[u])
+            {
+                if (e.to == skip || d + e.w >= wdist[e.to])
+                    continue;
+                if (wdist[e.to] == INF)
+                    touched.push_back(e.to);
+                wdist[e.to] = d + e.w;
+                pq.emplace_back(wdist[e.to], e.to);
+                std::push_heap(pq.begin(), pq.end(), std::greater<>());
+            }
+        }
+    }
+
+    // Fill `shortcuts` with the arcs contracting v would require
+    void find_shortcuts(int v, int max_settled)
+    {
+        shortcuts.clear();
+        for (const auto &ein : in[v])
+        {
+            int u = ein.to;
+            double limit = -1;
+            for (const auto &eout : out[v])
+                if (eout.to != u)
+                    limit = std::max(limit, ein.w + eout.w);
+            if (limit < 0)
+                continue;
+            witness_search(u, v, limit, max_settled);
+            for (const auto &eout : out[v])
+                if (eout.to != u && wdist[eout.to] > ein.w + eout.w)
+                    shortcuts.push_back({u, eout.to, ein.w + eout.w});
+        }
+    }
+
+    // Edge difference plus already-contracted neighbours (keeps contraction spread out)
+    int priority(int v)
+    {
+        find_shortcuts(v, ESTIMATE_LIMIT);
+        int removed = static_cast<int>(in[v].size() + out[v].size());
+        return static_cast<int>(shortcuts.size()) - removed + deleted_neighbors[v];
+    }
+
+    // Contract v: its remaining arcs become search-graph edges, shortcuts bridge its neighbours
+    std::vector<int> contract(int v)
+    {
+        find_shortcuts(v, CONTRACT_LIMIT);
+        up_edges[v] = out[v];
+        down_edges[v] = in[v];
+
+        std::vector<int> neighbors;
+        for (const auto &e : out[v])
+        {
+            remove_arc(in[e.to], v);
+            neighbors.push_back(e.to);
+        }
+        for (const auto &e : in[v])
+        {
+            remove_arc(out[e.to], v);
+            neighbors.push_back(e.to);
+        }
+        out[v].clear();
+        out[v].shrink_to_fit();
+        in[v].clear();
+        in[v].shrink_to_fit();
+        contracted[v] = 1;
+
+        for (const auto &sc : shortcuts)
+            add_arc(sc.from, sc.to, sc.w, v);
+
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        return neighbors;
+    }
+
+    static void pack(std::vector<std::vector<CHEdge>> &lists, std::vector<uint32_t> &offsets, std::vector<CHEdge> &edges)
+    {
+        offsets.assign(lists.size() + 1, 0);
+        for (size_t u = 0; u < lists.size(); ++u)
+            offsets[u + 1] = offsets[u] + static_cast<uint32_t>(lists[u].size());
+        edges.clear();
+        edges.reserve(offsets.back());
+        for (auto &l : lists)
+        {
+            edges.insert(edges.end(), l.begin(), l.end());
+            std::vector<CHEdge>().swap(l);
+        }
+    }
+};
+
+template <typename GraphT>
+ContractionHierarchy build_ch(const GraphT &G)
+{
+    return CHBuilder(G).build();
+}
+
+// Bidirectional upward search with stall-on-demand; reusable across queries
+class CHQuery
+{
+public:
+    explicit CHQuery(const ContractionHierarchy &H)
+        : H(H), fwd(H.size()), bwd(H.size()) {}
+
+    // Shortest s-t distance (INF if unreachable); optionally logs every scanned edge
+    double distance(int s, int t, std::vector<std::pair<int, int>> *explored_edges = nullptr)
+    {
+        fwd.reset();
+        bwd.reset();
+        settled_nodes = 0;
+        meet = -1;
+        best = INF;
+        fwd.start(s);
+        bwd.start(t);
+
+        while (true)
+        {
+            double fmin = fwd.min_key(), bmin = bwd.min_key();
+            if (std::min(fmin, bmin) >= best)
+                break;
+            if (fmin <= bmin)
+                step(fwd, bwd, true, explored_edges);
+            else
+                step(bwd, fwd, false, explored_edges);
+        }
+        return best;
+    }
+
+    // Original-graph node sequence of the last query, shortcuts unpacked (empty if unreachable)
+    std::vector<int> path() const
+    {
+        std::vector<int> path;
+        if (meet == -1)
+            return path;
+        std::vector<int> upward;
+        for (int at = meet; at != -1; at = fwd.prev[at])
+            upward.push_back(at);
+        std::reverse(upward.begin(), upward.end());
+        path.push_back(upward.front());
+        for (size_t i = 1; i < upward.size(); ++i)
+            unpack(upward[i - 1], upward[i], path);
+        for (int at = meet; bwd.prev[at] != -1; at = bwd.prev[at])
+            unpack(at, bwd.prev[at], path);
+        return path;
+    }
+
+    int settled() const { return settled_nodes; }
+
+private:
+    struct Side {
+        std::vector<double> dist;
+        std::vector<int> prev;     // forward: predecessor; backward: successor towards t
+        std::vector<int> touched;
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>,
+                            std::greater<std::pair<double, int>>> pq;
+
+        explicit Side(int n) : dist(n, INF), prev(n, -1) {}
+        void reset()
+        {
+            for (int v : touched)
+                dist[v] = INF, prev[v] = -1;
+            touched.clear();
+            pq = {};
+        }
+        void start(int s)
+        {
+            dist[s] = 0;
+            touched.push_back(s);
+            pq.emplace(0, s);
+        }
+        double min_key()
+        {
+            while (!pq.empty() && pq.top().first > dist[pq.top().second])
+                pq.pop();
+            return pq.empty() ? INF : pq.top().first;
+        }
+    };
+
+    const ContractionHierarchy &H;
+    Side fwd, bwd;
+    int settled_nodes = 0;
+    int meet = -1;
+    double best = INF;
+
+    void step(Side &me, const Side &other, bool forward, std::vector<std::pair<int, int>> *explored_edges)
+    {
+        auto [d, u] = me.pq.top();
+        me.pq.pop();
+        ++settled_nodes;
+        if (other.dist[u] != INF && d + other.dist[u] < best)
+        {
+            best = d + other.dist[u];
+            meet = u;
+        }
+
+        const auto &search = forward ? H.up : H.down;
+        const auto &search_off = forward ? H.up_offsets : H.down_offsets;
+        const auto &stall = forward ? H.down : H.up;
+        const auto &stall_off = forward ? H.down_offsets : H.up_offsets;
+
+        // Stall-on-demand: a higher node already reaches u more cheaply, so u is not on a shortest up-path
+        for (uint32_t i = stall_off[u]; i < stall_off[u + 1]; ++i)
+            if (me.dist[stall[i].to] + stall[i].w < d)
+                return;
+
+        for (uint32_t i = search_off[u]; i < search_off[u + 1]; ++i)
+        {
+            const CHEdge &e = search[i];
+            if (explored_edges)
+                explored_edges->push_back(forward ? std::make_pair(u, e.to) : std::make_pair(e.to, u));
+            if (d + e.w < me.dist[e.to])
+            {
+                if (me.dist[e.to] == INF)
+                    me.touched.push_back(e.to);
+                me.dist[e.to] = d + e.w;
+                me.prev[e.to] = u;
+                me.pq.emplace(me.dist[e.to], e.to);
+            }
+        }
+    }
+
+    // Cheapest search-graph edge a -> b
+    const CHEdge &find_edge(int a, int b) const
+    {
+        const CHEdge *best_edge = nullptr;
+        if (H.rank[a] < H.rank[b])
+        {
+            for (uint32_t i = H.up_offsets[a]; i < H.up_offsets[a + 1]; ++i)
+                if (H.up[i].to == b && (!best_edge || H.up[i].w < best_edge->w))
+                    best_edge = &H.up[i];
+        }
+        else
+        {
+            for (uint32_t i = H.down_offsets[b]; i < H.down_offsets[b + 1]; ++i)
+                if (H.down[i].to == a && (!best_edge || H.down[i].w < best_edge->w))
+                    best_edge = &H.down[i];
+        }
+        return *best_edge;
+    }
+
+    // Append the original nodes after a on the edge a -> b (explicit stack: shortcuts nest deeply)
+    void unpack(int a, int b, std::vector<int> &path) const
+    {
+        std::vector<std::pair<int, int>> stack = {{a, b}};
+        while (!stack.empty())
+        {
+            auto [x, y] = stack.back();
+            stack.pop_back();
+            int mid = find_edge(x, y).mid;
+            if (mid == -1)
+            {
+                path.push_back(y);
+                continue;
+            }
+            stack.push_back({mid, y});
+            stack.push_back({x, mid});
+        }
+    }
+};
+
+// Hierarchy file: magic, version, graph checksum, n, edge counts, then rank and both CSR search graphs
+const char CH_MAGIC[8] = {'D', 'V', 'A', 'C', 'H', 'I', 'E', 'R'};
+const uint32_t CH_VERSION = 2;
+
+// "../input_edges/graph_x_edges.txt" -> "../input_edges/graph_x_edges.ch"
+inline std::string ch_path(const std::string &input)
+{
+    std::string bin = graph_bin_path(input);
+    return bin.substr(0, bin.size() - 4) + ".ch";
+}
+
+inline void save_ch(const std::string &filename, uint64_t checksum, const ContractionHierarchy &H)
+{
+    std::ofstream out(filename, std::ios::binary);
+    uint64_t counts[3] = {static_cast<uint64_t>(H.size()), H.up.size(), H.down.size()};
+    out.write(CH_MAGIC, sizeof(CH_MAGIC));
+    out.write(reinterpret_cast<const char *>(&CH_VERSION), sizeof(CH_VERSION));
+    out.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+    out.write(reinterpret_cast<const char *>(counts), sizeof(counts));
+    out.write(reinterpret_cast<const char *>(H.rank.data()), H.rank.size() * sizeof(int));
+    out.write(reinterpret_cast<const char *>(H.up_offsets.data()), H.up_offsets.size() * sizeof(uint32_t));
+    out.write(reinterpret_cast<const char *>(H.up.data()), H.up.size() * sizeof(CHEdge));
+    out.write(reinterpret_cast<const char *>(H.down_offsets.data()), H.down_offsets.size() * sizeof(uint32_t));
+    out.write(reinterpret_cast<const char *>(H.down.data()), H.down.size() * sizeof(CHEdge));
+    if (!out)
+        throw std::runtime_error("cannot write " + filename);
+}
+
+// Fill H from the file if it exists and was built for this graph (same checksum and node count)
+inline bool load_ch(const std::string &filename, uint64_t checksum, int n, ContractionHierarchy &H)
+{
+    std::ifstream in(filename, std::ios::binary);
+    char magic[8];
+    uint32_t version = 0;
+    uint64_t file_checksum = 0, counts[3] = {0, 0, 0};
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    in.read(reinterpret_cast<char *>(&file_checksum), sizeof(file_checksum));
+    in.read(reinterpret_cast<char *>(counts), sizeof(counts));
+    if (!in || std::memcmp(magic, CH_MAGIC, sizeof(magic)) != 0 || version != CH_VERSION ||
+        file_checksum != checksum || counts[0] != static_cast<uint64_t>(n))
+        return false;
+
+    H.rank.resize(counts[0]);
+    H.up_offsets.resize(counts[0] + 1);
+    H.up.resize(counts[1]);
+    H.down_offsets.resize(counts[0] + 1);
+    H.down.resize(counts[2]);
+    in.read(reinterpret_cast<char *>(H.rank.data()), H.rank.size() * sizeof(int));
+    in.read(reinterpret_cast<char *>(H.up_offsets.data()), H.up_offsets.size() * sizeof(uint32_t));
+    in.read(reinterpret_cast<char *>(H.up.data()), H.up.size() * sizeof(CHEdge));
+    in.read(reinterpret_cast<char *>(H.down_offsets.data()), H.down_offsets.size() * sizeof(uint32_t));
+    in.read(reinterpret_cast<char *>(H.down.data()), H.down.size() * sizeof(CHEdge));
+    return static_cast<bool>(in);
+}
+
+// Hierarchy for G from its cache file next to input; built and saved there on first use, or again
+// when the file is stale (another graph, an older version) or truncated
+template <typename GraphT>
+ContractionHierarchy open_ch(const GraphT &G, const std::string &input)
+{
+    ContractionHierarchy H;
+    std::string hierarchy = ch_path(input);
+    uint64_t checksum = graph_checksum(G);
+    if (!load_ch(hierarchy, checksum, G.size(), H))
+    {
+        H = build_ch(G);
+        save_ch(hierarchy, checksum, H);
+    }
+    return H;
+}
+
+#endif  // CH_H
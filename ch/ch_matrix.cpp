@@ -0,0 +1,74 @@
+//Many-to-many distance table: loads (or builds) the hierarchy once per dataset, then computes an
+//origin x destination matrix with the CH bucket algorithm and writes it as a binary float32 table.
+//
+//   ch_matrix                         every dataset below, MATRIX_SIZE random sources and targets
+//   ch_matrix <edges.txt> <queries.txt> <out.bin> [threads]
+//                                     sources and targets from "s t" lines (see batch_engine.h),
+//                                     matrix over all sources x all targets
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../batch/batch_engine.h"
+#include "ch.h"
+#include "ch_matrix.h"
+#include <iostream>
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int MATRIX_SIZE = 1000;
+
+void run(const string& input, const vector<int>& sources, const vector<int>& targets,
+         const string& output, int threads, const CSRGraph32& G)
+{
+    Timer preprocessing;
+    preprocessing.start();
+    ContractionHierarchy H = open_ch(G, input);
+    preprocessing.pause();
+
+    Timer runtime;
+    runtime.start();
+    DistanceTable T = distance_table(H, sources, targets, threads);
+    runtime.pause();
+    save_distance_table(output, T);
+
+    size_t unreachable = count(T.dist.begin(), T.dist.end(), static_cast<float>(INF));
+    cout << "Matrix " << T.rows() << " x " << T.cols() << " (" << input << "): " << runtime.elapsed()
+         << " seconds on " << threads << " threads, " << unreachable << " unreachable pairs -> " << output << "\n";
+    cout << "Preprocessing: " << preprocessing.elapsed() << " seconds\n";
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 4) {
+        CSRGraph32 G = open_graph(argv[1]);  // binary if convert_graph was run
+        vector<int> sources, targets;
+        for (const Query& q : read_queries(argv[2], G.size())) {
+            sources.push_back(q.s);
+            targets.push_back(q.t);
+        }
+        run(argv[1], sources, targets, argv[3], argc >= 5 ? stoi(argv[4]) : default_threads(), G);
+        return 0;
+    }
+
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
+        vector<int> sources = {source}, targets = {static_cast<int>(G.size()) - 1};  // the mains' query first
+        for (const Query& q : random_queries(G.size(), MATRIX_SIZE - 1)) {
+            sources.push_back(q.s);
+            targets.push_back(q.t);
+        }
+        run(input, sources, targets, "../map_data/graph_" + name + "_matrix_ch.bin", default_threads(), G);
+    }
+}
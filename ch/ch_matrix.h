@@ -0,0 +1,169 @@
+//Many-to-many distance tables on a contraction hierarchy (bucket algorithm): one backward upward search
+//per target leaves (target, distance) entries in per-node buckets, then one forward upward search per
+//source scans the buckets of the nodes it settles. |S| + |T| small searches instead of |S| x |T| queries.
+#ifndef CH_MATRIX_H
+#define CH_MATRIX_H
+
+#include "../helpers/graph_io.h"
+#include "../helpers/parallel.h"
+#include "../helpers/search_workspace.h"
+#include "ch.h"
+#include <vector>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// |sources| x |targets| table, row-major; float halves the size and is exact for integer
+// distances below 2^24 (16,777 km in whole meters); INF where t is unreachable from s
+struct DistanceTable {
+    std::vector<int> sources, targets;
+    std::vector<float> dist;
+
+    size_t rows() const { return sources.size(); }
+    size_t cols() const { return targets.size(); }
+    float at(size_t i, size_t j) const { return dist[i * cols() + j]; }
+};
+
+// Upward search from s in the forward (H.up) or backward (H.down) search graph, run to exhaustion
+// with stall-on-demand; calls visit(v, d) for every settled node that is not stalled
+template <typename Visit>
+void ch_upward_search(const ContractionHierarchy &H, int s, bool forward, SearchWorkspace &ws, Visit visit)
+{
+    const auto &search = forward ? H.up : H.down;
+    const auto &search_off = forward ? H.up_offsets : H.down_offsets;
+    const auto &stall = forward ? H.down : H.up;
+    const auto &stall_off = forward ? H.down_offsets : H.up_offsets;
+
+    ws.begin(H.size());
+    auto &pq = ws.queue;
+    std::greater<SearchWorkspace::QueueEntry> later;
+    ws.set_dist(s, 0);
+    pq.emplace_back(0, s);
+    while (!pq.empty())
+    {
+        std::pop_heap(pq.begin(), pq.end(), later);
+        auto [d, u] = pq.back();
+        pq.pop_back();
+        if (ws.settled(u))
+            continue;
+        ws.settle(u);
+
+        bool stalled = false;
+        for (uint32_t i = stall_off[u]; i < stall_off[u + 1] && !stalled; ++i)
+            stalled = ws.dist(stall[i].to) + stall[i].w < d;
+        if (stalled)
+            continue;
+        visit(u, d);
+
+        for (uint32_t i = search_off[u]; i < search_off[u + 1]; ++i)
+        {
+            const CHEdge &e = search[i];
+            if (d + e.w < ws.dist(e.to))
+            {
+                ws.set_dist(e.to, d + e.w);
+                pq.emplace_back(d + e.w, e.to);
+                std::push_heap(pq.begin(), pq.end(), later);
+            }
+        }
+    }
+}
+
+inline DistanceTable distance_table(const ContractionHierarchy &H, const std::vector<int> &sources,
+                                    const std::vector<int> &targets, int threads = default_threads())
+{
+    struct Entry {
+        int target;  // column index
+        double dist; // d(v, target)
+    };
+    int n = H.size();
+    threads = std::max(1, threads);
+    std::vector<SearchWorkspace> workspaces(threads);
+
+    // Backward searches, one per target; entries tagged with their node, then bucketed by node (CSR)
+    std::vector<std::vector<std::pair<int, Entry>>> found(threads);
+    parallel_for_stealing(targets.size(), threads, [&](size_t j, int tid) {
+        ch_upward_search(H, targets[j], false, workspaces[tid], [&](int v, double d) {
+            found[tid].push_back({v, {static_cast<int>(j), d}});
+        });
+    });
+    std::vector<uint32_t> bucket_off(n + 1, 0);
+    for (const auto &list : found)
+        for (const auto &f : list)
+            ++bucket_off[f.first + 1];
+    for (int v = 0; v < n; ++v)
+        bucket_off[v + 1] += bucket_off[v];
+    std::vector<Entry> buckets(bucket_off[n]);
+    std::vector<uint32_t> fill(bucket_off.begin(), bucket_off.end() - 1);
+    for (auto &list : found)
+    {
+        for (const auto &f : list)
+            buckets[fill[f.first]++] = f.second;
+        std::vector<std::pair<int, Entry>>().swap(list);
+    }
+
+    // Forward searches, one per source, each filling its own row
+    DistanceTable T;
+    T.sources = sources;
+    T.targets = targets;
+    T.dist.assign(sources.size() * targets.size(), static_cast<float>(INF));
+    std::vector<std::vector<double>> best(threads);
+    parallel_for_stealing(sources.size(), threads, [&](size_t i, int tid) {
+        auto &row = best[tid];
+        row.assign(targets.size(), INF);
+        ch_upward_search(H, sources[i], true, workspaces[tid], [&](int u, double d) {
+            for (uint32_t b = bucket_off[u]; b < bucket_off[u + 1]; ++b)
+                row[buckets[b].target] = std::min(row[buckets[b].target], d + buckets[b].dist);
+        });
+        std::copy(row.begin(), row.end(), T.dist.begin() + i * targets.size());
+    });
+    return T;
+}
+
+// Matrix file: magic, version, rows, cols, then source ids, target ids and the float32 table
+const char MATRIX_MAGIC[8] = {'D', 'V', 'A', 'M', 'A', 'T', 'R', 'X'};
+const uint32_t MATRIX_VERSION = 1;
+
+inline void save_distance_table(const std::string &filename, const DistanceTable &T)
+{
+    std::ofstream out(filename, std::ios::binary);
+    uint64_t dims[2] = {T.rows(), T.cols()};
+    out.write(MATRIX_MAGIC, sizeof(MATRIX_MAGIC));
+    out.write(reinterpret_cast<const char *>(&MATRIX_VERSION), sizeof(MATRIX_VERSION));
+    out.write(reinterpret_cast<const char *>(dims), sizeof(dims));
+    out.write(reinterpret_cast<const char *>(T.sources.data()), T.sources.size() * sizeof(int));
+    out.write(reinterpret_cast<const char *>(T.targets.data()), T.targets.size() * sizeof(int));
+    out.write(reinterpret_cast<const char *>(T.dist.data()), T.dist.size() * sizeof(float));
+    if (!out)
+        throw std::runtime_error("cannot write " + filename);
+}
+
+inline DistanceTable load_distance_table(const std::string &filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    char magic[8];
+    uint32_t version = 0;
+    uint64_t dims[2] = {0, 0};
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    in.read(reinterpret_cast<char *>(dims), sizeof(dims));
+    if (!in || std::memcmp(magic, MATRIX_MAGIC, sizeof(magic)) != 0 || version != MATRIX_VERSION)
+        throw std::runtime_error(filename + ": not a distance table (or wrong version)");
+
+    DistanceTable T;
+    T.sources.resize(dims[0]);
+    T.targets.resize(dims[1]);
+    T.dist.resize(dims[0] * dims[1]);
+    in.read(reinterpret_cast<char *>(T.sources.data()), T.sources.size() * sizeof(int));
+    in.read(reinterpret_cast<char *>(T.targets.data()), T.targets.size() * sizeof(int));
+    in.read(reinterpret_cast<char *>(T.dist.data()), T.dist.size() * sizeof(float));
+    if (!in)
+        throw std::runtime_error(filename + ": truncated distance table");
+    return T;
+}
+
+#endif  // CH_MATRIX_H
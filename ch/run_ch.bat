@@ -0,0 +1,30 @@
+@echo off
+echo ==============================
+echo Compiling Contraction Hierarchies
+echo ==============================
+
+REM Create build folder if not existing
+if not exist ..\build mkdir ..\build
+
+echo [1/2] Compiling ch...
+g++ -std=c++17 -O2 -I..\helpers ch.cpp ..\helpers\timer.cpp -o ..\build\ch.exe
+
+echo [2/2] Compiling ch_matrix...
+g++ -std=c++17 -O2 -I..\helpers ch_matrix.cpp ..\helpers\timer.cpp -o ..\build\ch_matrix.exe
+
+echo ==============================
+echo Running Contraction Hierarchies
+echo ==============================
+
+echo Running ch...
+..\build\ch.exe
+
+echo ==============================
+
+echo Running ch_matrix...
+..\build\ch_matrix.exe
+
+echo ==============================
+echo ✅ CH queries completed.
+echo ==============================
+pause
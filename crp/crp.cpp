@@ -0,0 +1,63 @@
+//Customizable route planning: partitions the graph once per dataset, customizes the overlay for the
+//input weights, then answers the same query as the other mains on the overlay and unpacks the path.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "crp.h"
+#include <iostream>
+#include <bits/stdc++.h>
+
+using namespace std;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        string explored_output = "../map_data/graph_" + name + "_visited_edges_crp.txt";
+        string path_output = "../map_data/graph_" + name + "_final_nodes_crp.txt";
+
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
+        int s = source, t = G.size() - 1;
+        bool reachable = may_reach(input, G, s, t);
+        vector<LatLon> coords = open_coords(input, "../map_data/graph_" + name + "_nodes.txt", G.size());
+
+        // Partition (metric independent), then customization for the input weights
+        Timer preprocessing, customization;
+        preprocessing.start();
+        PartitionOverlay O = build_overlay(G, coords);
+        preprocessing.pause();
+        customization.start();
+        OverlayMetric M = customize(O, G);
+        customization.pause();
+
+        Timer runtime;
+        OverlayQuery query(O, G, M);
+        vector<pair<int, int>> explored;
+        runtime.start();
+        double dist = reachable ? query.distance(s, t) : INF;
+        runtime.pause();
+        if (reachable)
+            query.distance(s, t, &explored);  // untimed rerun that collects the explored edges
+        write_edges(explored_output, explored);
+        write_path(path_output, reachable ? query.path() : vector<int>());
+
+        cout << "Shortest distance (" << name << "): " << dist << "\n";
+        cout << "Time (" << name << "): " << runtime.elapsed() << " seconds\n";
+        cout << "Preprocessing (" << name << "): partition " << preprocessing.elapsed() << " seconds"
+             << (coords.empty() ? " (no coordinates, RCM order)" : "") << ", customization "
+             << customization.elapsed() << " seconds, " << query.settled() << " nodes settled\n";
+        for (int l = 1; l <= O.levels(); ++l)
+            cout << "  level " << l << ": " << O.num_cells(l) << " cells, " << O.boundary[l - 1].size()
+                 << " boundary nodes\n";
+    }
+}
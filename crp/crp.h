@@ -0,0 +1,364 @@
+//Customizable route planning (CRP): a multi-level partition of the nodes into nested cells, and per level
+//an overlay whose cell cliques hold the boundary-to-boundary distances inside each cell. The partition
+//comes from the node coordinates alone; only the cliques depend on the weights, so a new metric costs
+//one customization (cell-local searches, in parallel) instead of a new preprocessing.
+#ifndef CRP_H
+#define CRP_H
+
+#include "../helpers/graph_io.h"
+#include "../helpers/csr_graph.h"
+#include "../helpers/graph_order.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/parallel.h"
+#include <vector>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+// Metric-independent part: cells and their boundary nodes. Levels are numbered 1 .. levels() from
+// the finest; the per-level arrays are indexed by level - 1. Every level-l cell is a union of
+// level-(l-1) cells, and a boundary node (endpoint of an arc between two cells) of level l is a
+// boundary node of every lower level too.
+struct PartitionOverlay {
+    std::vector<std::vector<int>> cell;              // cell[l-1][v]: v's cell on level l
+    std::vector<std::vector<int>> slot;              // slot[l-1][v]: v's position among its cell's boundary nodes, -1 inside
+    std::vector<std::vector<uint32_t>> boundary_offsets; // boundary nodes of cell c: boundary[l-1][offsets[c] .. offsets[c+1])
+    std::vector<std::vector<int>> boundary;
+    std::vector<std::vector<uint64_t>> clique_offsets;   // start of cell c's b x b matrix in the level's clique array
+
+    int levels() const { return static_cast<int>(cell.size()); }
+    int num_cells(int l) const { return static_cast<int>(boundary_offsets[l - 1].size()) - 1; }
+    int boundary_size(int l, int c) const {
+        return static_cast<int>(boundary_offsets[l - 1][c + 1] - boundary_offsets[l - 1][c]);
+    }
+    const int *boundary_nodes(int l, int c) const { return boundary[l - 1].data() + boundary_offsets[l - 1][c]; }
+
+    // Highest level on which v shares its cell with neither s nor t (0 if it shares the finest one):
+    // a query settling v only needs that level's overlay arcs
+    int query_level(int s, int t, int v) const {
+        int l = levels();
+        while (l > 0 && (cell[l - 1][v] == cell[l - 1][s] || cell[l - 1][v] == cell[l - 1][t]))
+            --l;
+        return l;
+    }
+};
+
+// Metric-dependent part: clique[l-1] holds, cell after cell, the row-major b x b matrix of shortest
+// distances between the cell's boundary nodes through the cell (inf if there is no such path)
+struct OverlayMetric {
+    std::vector<std::vector<float>> clique;
+
+    size_t memory_bytes() const {
+        size_t bytes = 0;
+        for (const auto &c : clique)
+            bytes += c.size() * sizeof(float);
+        return bytes;
+    }
+};
+
+// Recursive inertial bisection: splits a node range at the median of its projection on the principal
+// axis of its points, until the pieces fit the finest cell size. The first piece on a recursion path
+// that fits the level-l size becomes a level-l cell, so the cells nest by construction.
+class PartitionBuilder
+{
+public:
+    PartitionBuilder(std::vector<std::pair<double, double>> points, std::vector<int> cell_sizes)
+        : points(std::move(points)), sizes(std::move(cell_sizes)), ids(this->points.size()),
+          key(this->points.size()), cell(sizes.size(), std::vector<int>(this->points.size(), -1)),
+          count(sizes.size(), 0)
+    {
+        if (sizes.empty() || !std::is_sorted(sizes.begin(), sizes.end()) || sizes.front() < 1)
+            throw std::invalid_argument("cell sizes must be positive and increasing");
+        std::iota(ids.begin(), ids.end(), 0);
+        split(0, ids.size(), static_cast<int>(sizes.size()));
+    }
+
+    std::vector<std::vector<int>> cells() { return std::move(cell); }
+
+private:
+    std::vector<std::pair<double, double>> points;
+    std::vector<int> sizes;
+    std::vector<int> ids;
+    std::vector<double> key;
+    std::vector<std::vector<int>> cell;
+    std::vector<int> count;
+
+    // assigned: lowest level whose cell already contains this range (levels + 1 above the top)
+    void split(size_t begin, size_t end, int assigned)
+    {
+        size_t size = end - begin;
+        while (assigned > 0 && size <= static_cast<size_t>(sizes[assigned - 1]))
+        {
+            --assigned;
+            for (size_t i = begin; i < end; ++i)
+                cell[assigned][ids[i]] = count[assigned];
+            ++count[assigned];
+        }
+        if (assigned == 0)
+            return;
+
+        double mx = 0, my = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            mx += points[ids[i]].first;
+            my += points[ids[i]].second;
+        }
+        mx /= size;
+        my /= size;
+        double sxx = 0, sxy = 0, syy = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            double dx = points[ids[i]].first - mx, dy = points[ids[i]].second - my;
+            sxx += dx * dx;
+            sxy += dx * dy;
+            syy += dy * dy;
+        }
+        double angle = 0.5 * std::atan2(2 * sxy, sxx - syy); // principal axis of the 2x2 covariance
+        double ax = std::cos(angle), ay = std::sin(angle);
+        for (size_t i = begin; i < end; ++i)
+            key[ids[i]] = ax * points[ids[i]].first + ay * points[ids[i]].second;
+
+        size_t mid = begin + size / 2;
+        std::nth_element(ids.begin() + begin, ids.begin() + mid, ids.begin() + end,
+                         [&](int a, int b) { return key[a] != key[b] ? key[a] < key[b] : a < b; });
+        split(begin, mid, assigned);
+        split(mid, end, assigned);
+    }
+};
+
+// Builds the partition and its boundary lists. Points are the coordinates projected to the plane, or,
+// without coordinates, positions in the RCM order on a line (cells are then runs of that order).
+template <typename GraphT>
+PartitionOverlay build_overlay(const GraphT &G, const std::vector<LatLon> &coords,
+                               std::vector<int> cell_sizes = {512, 4096, 32768})
+{
+    int n = G.size();
+    std::vector<std::pair<double, double>> points(n);
+    if (static_cast<int>(coords.size()) == n)
+    {
+        double lat0 = 0;
+        for (const LatLon &c : coords)
+            lat0 += c.lat / std::max(n, 1);
+        double shrink = std::cos(lat0 * M_PI / 180); // longitude degrees are shorter away from the equator
+        for (int v = 0; v < n; ++v)
+            points[v] = {coords[v].lon * shrink, coords[v].lat};
+    }
+    else
+    {
+        NodeOrder order = rcm_order(G);
+        for (int v = 0; v < n; ++v)
+            points[v] = {static_cast<double>(order.to_new[v]), 0.0};
+    }
+
+    PartitionOverlay O;
+    O.cell = PartitionBuilder(std::move(points), std::move(cell_sizes)).cells();
+    int levels = O.levels();
+    O.slot.assign(levels, std::vector<int>(n, -1));
+    O.boundary_offsets.resize(levels);
+    O.boundary.resize(levels);
+    O.clique_offsets.resize(levels);
+    for (int l = 0; l < levels; ++l)
+    {
+        const std::vector<int> &cell = O.cell[l];
+        std::vector<char> is_boundary(n, 0);
+        for (int u = 0; u < n; ++u)
+            for (auto [v, w] : G[u])
+                if (cell[u] != cell[v])
+                    is_boundary[u] = is_boundary[v] = 1;
+
+        int cells = *std::max_element(cell.begin(), cell.end()) + 1;
+        std::vector<uint32_t> &offsets = O.boundary_offsets[l];
+        offsets.assign(cells + 1, 0);
+        for (int v = 0; v < n; ++v)
+            offsets[cell[v] + 1] += is_boundary[v];
+        for (int c = 0; c < cells; ++c)
+            offsets[c + 1] += offsets[c];
+        O.boundary[l].resize(offsets[cells]);
+        std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+        for (int v = 0; v < n; ++v)
+            if (is_boundary[v])
+            {
+                O.slot[l][v] = static_cast<int>(next[cell[v]] - offsets[cell[v]]);
+                O.boundary[l][next[cell[v]]++] = v;
+            }
+
+        O.clique_offsets[l].assign(cells + 1, 0);
+        for (int c = 0; c < cells; ++c)
+        {
+            uint64_t b = offsets[c + 1] - offsets[c];
+            O.clique_offsets[l][c + 1] = O.clique_offsets[l][c] + b * b;
+        }
+    }
+    return O;
+}
+
+// Calls f(v, w) for every arc out of u on the given level: the input arcs on level 0; on level l, the
+// clique arcs of u's level-l cell (u must be one of its boundary nodes) and the input arcs leaving it
+template <typename GraphT, typename F>
+void overlay_arcs(const PartitionOverlay &O, const GraphT &G, const OverlayMetric &M, int level, int u, F &&f)
+{
+    if (level == 0)
+    {
+        for (auto [v, w] : G[u])
+            f(v, static_cast<double>(w));
+        return;
+    }
+    const std::vector<int> &cell = O.cell[level - 1];
+    int c = cell[u], b = O.boundary_size(level, c), i = O.slot[level - 1][u];
+    const int *nodes = O.boundary_nodes(level, c);
+    const float *row = M.clique[level - 1].data() + O.clique_offsets[level - 1][c] + static_cast<uint64_t>(i) * b;
+    for (int j = 0; j < b; ++j)
+        if (j != i && row[j] < INF)
+            f(nodes[j], static_cast<double>(row[j]));
+    for (auto [v, w] : G[u])
+        if (cell[v] != c)
+            f(v, static_cast<double>(w));
+}
+
+// Dijkstra from s over the arcs of arc_level, kept inside cell c of cell_level; stops at t (-1: never)
+template <typename GraphT>
+void cell_search(const PartitionOverlay &O, const GraphT &G, const OverlayMetric &M, int arc_level,
+                 int cell_level, int c, int s, int t, SearchWorkspace &ws)
+{
+    const std::vector<int> &cell = O.cell[cell_level - 1];
+    ws.begin(G.size());
+    auto &pq = ws.queue;
+    std::greater<SearchWorkspace::QueueEntry> later;
+    ws.set_dist(s, 0);
+    pq.emplace_back(0, s);
+    while (!pq.empty())
+    {
+        std::pop_heap(pq.begin(), pq.end(), later);
+        auto [d, u] = pq.back();
+        pq.pop_back();
+        if (ws.settled(u))
+            continue;
+        ws.settle(u);
+        if (u == t)
+            break;
+        overlay_arcs(O, G, M, arc_level, u, [&](int v, double w) {
+            if (cell[v] == c && !ws.settled(v) && d + w < ws.dist(v))
+            {
+                ws.set_dist(v, d + w);
+                ws.set_prev(v, u);
+                pq.emplace_back(d + w, v);
+                std::push_heap(pq.begin(), pq.end(), later);
+            }
+        });
+    }
+}
+
+// Customization: the cliques level by level, each level from the one below (level 1 from the input
+// arcs). G gives the metric and must have the topology the overlay was built on; cells run in parallel.
+template <typename GraphT>
+OverlayMetric customize(const PartitionOverlay &O, const GraphT &G, int threads = default_threads())
+{
+    OverlayMetric M;
+    M.clique.resize(O.levels());
+    std::vector<SearchWorkspace> workspaces(std::max(1, threads), SearchWorkspace(G.size()));
+    for (int l = 1; l <= O.levels(); ++l)
+    {
+        std::vector<float> &clique = M.clique[l - 1];
+        clique.assign(O.clique_offsets[l - 1].back(), std::numeric_limits<float>::infinity());
+        parallel_for_stealing(O.num_cells(l), threads, [&](size_t c, int tid) {
+            SearchWorkspace &ws = workspaces[tid];
+            int b = O.boundary_size(l, c);
+            const int *nodes = O.boundary_nodes(l, c);
+            float *matrix = clique.data() + O.clique_offsets[l - 1][c];
+            for (int i = 0; i < b; ++i)
+            {
+                cell_search(O, G, M, l - 1, l, c, nodes[i], -1, ws);
+                for (int j = 0; j < b; ++j)
+                    matrix[static_cast<uint64_t>(i) * b + j] = static_cast<float>(ws.dist(nodes[j]));
+            }
+        });
+    }
+    return M;
+}
+
+// Point-to-point query on the overlay: near s and t it scans input arcs, elsewhere only the clique and
+// cut arcs of the highest level separating a node from both ends. Reusable across queries.
+template <typename GraphT>
+class OverlayQuery
+{
+public:
+    OverlayQuery(const PartitionOverlay &O, const GraphT &G, const OverlayMetric &M)
+        : O(O), G(G), M(M), ws(G.size()), unpack_ws(G.size()) {}
+
+    // Shortest s-t distance (INF if unreachable); optionally logs every scanned arc
+    double distance(int s, int t, std::vector<std::pair<int, int>> *explored_edges = nullptr)
+    {
+        source = s;
+        target = t;
+        settled_nodes = 0;
+        ws.begin(G.size());
+        auto &pq = ws.queue;
+        std::greater<SearchWorkspace::QueueEntry> later;
+        ws.set_dist(s, 0);
+        pq.emplace_back(0, s);
+        while (!pq.empty())
+        {
+            std::pop_heap(pq.begin(), pq.end(), later);
+            auto [d, u] = pq.back();
+            pq.pop_back();
+            if (ws.settled(u))
+                continue;
+            ws.settle(u);
+            ++settled_nodes;
+            if (u == t)
+                break;
+            overlay_arcs(O, G, M, O.query_level(s, t, u), u, [&](int v, double w) {
+                if (explored_edges)
+                    explored_edges->push_back({u, v});
+                if (!ws.settled(v) && d + w < ws.dist(v))
+                {
+                    ws.set_dist(v, d + w);
+                    ws.set_prev(v, u);
+                    pq.emplace_back(d + w, v);
+                    std::push_heap(pq.begin(), pq.end(), later);
+                }
+            });
+        }
+        return ws.dist(t);
+    }
+
+    // Input-graph node sequence of the last query, clique arcs unpacked by a search inside their cell
+    std::vector<int> path()
+    {
+        std::vector<int> overlay_path = ws.path(target), path;
+        if (overlay_path.empty())
+            return path;
+        path.push_back(overlay_path.front());
+        for (size_t i = 1; i < overlay_path.size(); ++i)
+        {
+            int u = overlay_path[i - 1], v = overlay_path[i];
+            int l = O.query_level(source, target, u);
+            if (l == 0 || O.cell[l - 1][u] != O.cell[l - 1][v])
+            {
+                path.push_back(v); // input arc
+                continue;
+            }
+            cell_search(O, G, M, 0, l, O.cell[l - 1][u], u, v, unpack_ws);
+            std::vector<int> inner = unpack_ws.path(v);
+            path.insert(path.end(), inner.begin() + 1, inner.end());
+        }
+        return path;
+    }
+
+    int settled() const { return settled_nodes; }
+
+private:
+    const PartitionOverlay &O;
+    const GraphT &G;
+    const OverlayMetric &M;
+    SearchWorkspace ws, unpack_ws;
+    int source = -1, target = -1;
+    int settled_nodes = 0;
+};
+
+#endif  // CRP_H
@@ -0,0 +1,22 @@
+@echo off
+echo ==============================
+echo Compiling Customizable Route Planning
+echo ==============================
+
+REM Create build folder if not existing
+if not exist ..\build mkdir ..\build
+
+echo [1/1] Compiling crp...
+g++ -std=c++17 -O2 -I..\helpers crp.cpp ..\helpers\timer.cpp -o ..\build\crp.exe
+
+echo ==============================
+echo Running Customizable Route Planning
+echo ==============================
+
+echo Running crp...
+..\build\crp.exe
+
+echo ==============================
+echo ✅ CRP queries completed.
+echo ==============================
+pause
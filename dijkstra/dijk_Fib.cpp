@@ -3,66 +3,13 @@
 
 #include "../helpers/timer.h"
 #include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/trace_sink.h"
+#include "dijk_Fib.h"
 #include <iostream>
 #include <bits/stdc++.h>
-#include <boost/heap/fibonacci_heap.hpp>
 
 using namespace std;
-const double INF = numeric_limits<double>::infinity();
-
-vector<double> dijkstra_fib(const Graph &G, int s, int t, std::vector<std::pair<int, int>>& explored_edges, vector<int>& prev, Timer* timer)
-{
-    timer->start();
-    using Node = pair<double, int>;
-    using Fib = boost::heap::fibonacci_heap<Node, boost::heap::compare<greater<Node>>>;
-    using Handle = Fib::handle_type;
-    int n = G.size();
-    vector<double> dist(n, INF);
-    vector<char> vis(n, 0);
-    vector<Handle> ref(n);
-    Fib pq;
-    dist[s] = 0;
-    ref[s] = pq.push({0, s});
-
-    // For path reconstruction
-    timer->pause();
-    prev.assign(n, -1);
-    timer->start();
-
-    while (!pq.empty())
-    {
-        auto [d, u] = pq.top();
-        pq.pop();
-        if (vis[u])
-            continue;
-        vis[u] = 1;
-        if (u == t)
-            break;
-        for (auto [v, w] : G[u]) {
-            if (!vis[v] && d + w < dist[v])
-            {
-                dist[v] = d + w;
-
-                timer->pause();
-                prev[v] = u;
-                timer->start();
-
-                if (ref[v] == Handle())
-                    ref[v] = pq.push({dist[v], v});
-                else
-                    pq.update(ref[v], {dist[v], v});
-            }
-            
-            // Logging visited edges
-            timer->pause();
-            explored_edges.push_back({u, v});
-            timer->start();
-
-        }
-    }
-    timer->pause();
-    return dist;
-}
 
 /* ---------- demo ---------- */
 int main()
@@ -74,20 +21,24 @@ int main()
 
     for (const auto& [name, source] : datasets) {
         string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
         string explored_output = "../map_data/graph_" + name + "_visited_edges_dijk_Fib.txt";
         string path_output = "../map_data/graph_" + name + "_final_nodes_dijk_Fib.txt";
 
         Timer runtime;
-        Graph G = read_graph(input);
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
         int s = source, t = G.size() - 1;
-        vector<int> prev;
-        std::vector<std::pair<int, int>> explored;
+        bool reachable = may_reach(input, G, s, t);
+        SearchWorkspace ws(G.size());
 
-        auto dist = dijkstra_fib(G, s, t, explored, prev, &runtime);
-        write_edges(explored_output, explored);
-        write_path(path_output, reconstruct_path(prev, t));
+        auto search = [&](auto&& instr) { return reachable ? dijkstra_fib(G, s, t, ws, instr) : INF; };
+        double dist = timed_then_streamed(runtime, search, explored_output);
+        write_path(path_output, ws.path(t));
 
-        cout << "Shortest distance (" << name << "): " << dist[t] << "\n";
+        cout << "Shortest distance (" << name << "): " << dist << "\n";
         cout << "Time (" << name << "): " << runtime.elapsed() << " seconds\n";
     } 
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+//Fibonacci-heap Dijkstra: replaces the heap with a Fibonacci heap so decrease-key is amortized O(1), 
+//dropping the total time to O(E + V log V) at the cost of higher constant factors.
+#ifndef DIJK_FIB_H
+#define DIJK_FIB_H
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include <vector>
+#include <utility>
+#include <functional>
+#include <boost/heap/fibonacci_heap.hpp>
+
+// Fibonacci heap plus one node handle per vertex, kept in the workspace (ws.queue_of) and cleared by
+// its begin(); ref[v] is valid only while ws.reached(v)
+struct FibQueue
+{
+    using Node = std::pair<double, int>;
+    using Heap = boost::heap::fibonacci_heap<Node, boost::heap::compare<std::greater<Node>>>;
+
+    explicit FibQueue(int n) : ref(n) {}
+    void clear() { heap.clear(); }
+
+    Heap heap;
+    std::vector<Heap::handle_type> ref;
+};
+
+// Runs in ws and returns dist(s, t) (INF for t = -1, no target)
+template <typename GraphT, typename Instr = NoInstrumentation>
+double dijkstra_fib(const GraphT &G, int s, int t, SearchWorkspace &ws, Instr &&instr = Instr())
+{
+    ws.begin(G.size());
+    FibQueue &fib = ws.queue_of<FibQueue>(ws.size());
+    auto &pq = fib.heap;
+    auto &ref = fib.ref;
+    ws.set_dist(s, 0);
+    ref[s] = pq.push({0, s});
+    instr.push();
+
+    while (!pq.empty())
+    {
+        auto [d, u] = pq.top();
+        pq.pop();
+        instr.pop();
+        if (ws.settled(u))
+        {
+            instr.stale_pop();
+            continue;
+        }
+        ws.settle(u);
+        instr.settle(u);
+        if (u == t)
+            break;
+        for (auto [v, w] : G[u]) {
+            instr.scan(u, v);
+            if (!ws.settled(v) && d + w < ws.dist(v))
+            {
+                bool queued = ws.reached(v);
+                ws.set_dist(v, d + w);
+                ws.set_prev(v, u);
+                instr.relax(v);
+                if (!queued)
+                {
+                    ref[v] = pq.push({d + w, v});
+                    instr.push();
+                }
+                else
+                {
+                    pq.update(ref[v], {d + w, v});
+                    instr.decrease();
+                }
+            }
+        }
+    }
+    return t >= 0 ? ws.dist(t) : INF;
+}
+
+template <typename GraphT>
+std::vector<double> dijkstra_fib(const GraphT &G, int s, int t, std::vector<std::pair<int, int>>& explored_edges, std::vector<int>& prev, Timer* timer)
+{
+    SearchWorkspace ws(G.size());
+    EdgeLog log(explored_edges);
+    timed_then_traced(*timer, [&](auto &&instr) { return dijkstra_fib(G, s, t, ws, instr); }, log);
+    prev = ws.predecessors();
+    return ws.distances();
+}
+
+#endif  // DIJK_FIB_H
@@ -0,0 +1,44 @@
+//Bidirectional Dijkstra: grows a forward search from s and a backward search from t (on the reverse graph),
+//always advancing the side with the smaller queue key, and stops once top_f + top_b >= best s-t path found.
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/trace_sink.h"
+#include "dijk_bidir.h"
+#include <iostream>
+#include <bits/stdc++.h>
+
+using namespace std;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        string explored_output = "../map_data/graph_" + name + "_visited_edges_dijk_bidir.txt";
+        string path_output = "../map_data/graph_" + name + "_final_nodes_dijk_bidir.txt";
+
+        Timer runtime;
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
+        CSRGraph32 R = read_graph_header(input).directed ? reverse_graph(G) : G;
+        int s = source, t = G.size() - 1;
+        bool reachable = may_reach(input, G, s, t);
+        SearchWorkspace fwd(G.size()), bwd(G.size());
+
+        auto search = [&](auto&& instr) { return reachable ? dijkstra_bidir(G, R, s, t, fwd, bwd, instr) : INF; };
+        double dist = timed_then_streamed(runtime, search, explored_output);
+        write_path(path_output, fwd.path(t));
+
+        cout << "Shortest distance (" << name << "): " << dist << "\n";
+        cout << "Time (" << name << "): " << runtime.elapsed() << " seconds\n";
+    }
+}
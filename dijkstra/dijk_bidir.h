@@ -0,0 +1,116 @@
+//Bidirectional Dijkstra: grows a forward search from s and a backward search from t (on the reverse graph),
+//always advancing the side with the smaller queue key, and stops once top_f + top_b >= best s-t path found.
+#ifndef DIJK_BIDIR_H
+#define DIJK_BIDIR_H
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <functional>
+
+// Turn the two search trees into the unidirectional outputs: fwd's prev becomes an s -> t chain
+// through the meeting edge (mu -> mv), and fwd.dist(x) = best - d_b(x) along the backward half
+// (bwd's prev points towards t).
+inline void join_bidir_path(int mu, int mv, double best, const SearchWorkspace& bwd, SearchWorkspace& fwd)
+{
+    if (mu != mv)
+    {
+        fwd.set_dist(mv, best - bwd.dist(mv));
+        fwd.set_prev(mv, mu);
+    }
+    for (int x = mv; bwd.prev(x) != -1; x = bwd.prev(x))
+    {
+        int y = bwd.prev(x);
+        fwd.set_dist(y, best - bwd.dist(y));
+        fwd.set_prev(y, x);
+    }
+}
+
+// R is the reverse graph of G (pass G itself for undirected graphs).
+// Runs in two workspaces and returns dist(s, t); the s -> t path is fwd.path(t).
+template <typename GraphT, typename Instr = NoInstrumentation>
+double dijkstra_bidir(const GraphT &G, const GraphT &R, int s, int t, SearchWorkspace &fwd, SearchWorkspace &bwd, Instr &&instr = Instr())
+{
+    int n = G.size();
+    fwd.begin(n);
+    bwd.begin(n); // bwd's prev is the backward tree: next node towards t
+    std::greater<SearchWorkspace::QueueEntry> later;
+    auto &pqf = fwd.queue, &pqb = bwd.queue;
+    fwd.set_dist(s, 0);
+    bwd.set_dist(t, 0);
+    pqf.emplace_back(0, s);
+    pqb.emplace_back(0, t);
+    instr.push();
+    instr.push();
+
+    double best = (s == t) ? 0 : INF;
+    int mu = s, mv = s; // best path so far: s ~> mu -> mv ~> t
+
+    while (!pqf.empty() && !pqb.empty())
+    {
+        if (pqf.front().first + pqb.front().first >= best)
+            break;
+        bool forward = pqf.front().first <= pqb.front().first;
+        auto &ws = forward ? fwd : bwd;
+        const auto &other = forward ? bwd : fwd;
+        auto &pq = ws.queue;
+
+        std::pop_heap(pq.begin(), pq.end(), later);
+        auto [d, u] = pq.back();
+        pq.pop_back();
+        instr.pop();
+        if (ws.settled(u))
+        {
+            instr.stale_pop();
+            continue;
+        }
+        ws.settle(u);
+        instr.settle(u);
+
+        for (auto [v, w] : (forward ? G[u] : R[u]))
+        {
+            if (forward)
+                instr.scan(u, v);
+            else
+                instr.scan(v, u); // graph direction
+            double dv = other.dist(v);
+            if (dv != INF && d + w + dv < best)
+            {
+                best = d + w + dv;
+                mu = forward ? u : v;
+                mv = forward ? v : u;
+            }
+            if (!ws.settled(v) && d + w < ws.dist(v))
+            {
+                ws.set_dist(v, d + w);
+                ws.set_prev(v, u);
+                instr.relax(v);
+                pq.emplace_back(d + w, v);
+                std::push_heap(pq.begin(), pq.end(), later);
+                instr.push();
+            }
+        }
+    }
+
+    if (best != INF)
+        join_bidir_path(mu, mv, best, bwd, fwd);
+    return best;
+}
+
+template <typename GraphT>
+std::vector<double> dijkstra_bidir(const GraphT &G, const GraphT &R, int s, int t, std::vector<std::pair<int, int>>& explored_edges, std::vector<int>& prev, Timer* timer, int* settled_nodes = nullptr)
+{
+    SearchWorkspace fwd(G.size()), bwd(G.size());
+    EdgeLog log(explored_edges);
+    timed_then_traced(*timer, [&](auto &&instr) { return dijkstra_bidir(G, R, s, t, fwd, bwd, instr); }, log);
+    if (settled_nodes)
+        *settled_nodes = log.counters.settled;
+    prev = fwd.predecessors();
+    return fwd.distances(); // [t] holds distance
+}
+
+#endif  // DIJK_BIDIR_H
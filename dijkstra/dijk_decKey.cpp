@@ -3,125 +3,13 @@
 
 #include "../helpers/timer.h"
 #include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/trace_sink.h"
+#include "dijk_decKey.h"
 #include <iostream>
 #include <bits/stdc++.h>
 
 using namespace std;
-const double INF = numeric_limits<double>::infinity();
-
-class MinBinaryHeap
-{
-    vector<pair<double, int>> h; // (key,vertex)
-    vector<int> pos;             // vertex -> index, -1 if not present
-    void sift_up(int i)
-    {
-        while (i && h[i].first < h[(i - 1) / 2].first)
-        {
-            swap(h[i], h[(i - 1) / 2]);
-            pos[h[i].second] = i;
-            pos[h[(i - 1) / 2].second] = (i - 1) / 2;
-            i = (i - 1) / 2;
-        }
-    }
-    void sift_down(int i)
-    {
-        int n = h.size();
-        while (true)
-        {
-            int l = 2 * i + 1, r = 2 * i + 2, m = i;
-            if (l < n && h[l].first < h[m].first)
-                m = l;
-            if (r < n && h[r].first < h[m].first)
-                m = r;
-            if (m == i)
-                break;
-            swap(h[i], h[m]);
-            pos[h[i].second] = i;
-            pos[h[m].second] = m;
-            i = m;
-        }
-    }
-
-public:
-    explicit MinBinaryHeap(int N) : pos(N, -1) {}
-    bool empty() const { return h.empty(); }
-    void push(int v, double k)
-    {
-        h.emplace_back(k, v);
-        int i = h.size() - 1;
-        pos[v] = i;
-        sift_up(i);
-    } // insert new vertex
-    auto pop()
-    {
-        auto top = h.front();
-        auto last = h.back();
-        h[0] = last;
-        pos[last.second] = 0;
-        h.pop_back();
-        if (!h.empty())
-            sift_down(0);
-        pos[top.second] = -1;
-        return top;
-    }
-    void decrease(int v, double k)
-    {
-        int i = pos[v];
-        if (i == -1 || k >= h[i].first)
-            return;
-        h[i].first = k;
-        sift_up(i);
-    } // decrease‑key
-    int index(int v) const { return pos[v]; }
-};
-
-vector<double> dijkstra_dec_key(const Graph &G, int s, int t, std::vector<std::pair<int, int>>& explored_edges, vector<int>& prev, Timer* timer) 
-{
-    timer->start();
-    int n = G.size();
-    vector<double> dist(n, INF);
-    vector<char> vis(n, 0);
-    MinBinaryHeap bh(n);
-    dist[s] = 0;
-    bh.push(s, 0);
-
-    // For path reconstruction
-    timer->pause();
-    prev.assign(n, -1);
-    timer->start();
-
-    while (!bh.empty())
-    {
-        auto [d, u] = bh.pop();
-        if (vis[u])
-            continue;
-        vis[u] = 1;
-        if (u == t)
-            break;
-        for (auto [v, w] : G[u]) {
-            if (!vis[v] && d + w < dist[v])
-            {
-                dist[v] = d + w;
-
-                timer->pause();
-                prev[v] = u;
-                timer->start();
-
-                if (bh.index(v) == -1)
-                    bh.push(v, dist[v]);
-                else
-                    bh.decrease(v, dist[v]);
-            }
-            
-            // Logging visited edges
-            timer->pause();
-            explored_edges.push_back({u, v});
-            timer->start();
-        }
-    }
-    timer->pause();
-    return dist;
-}
 
 /* ---------- demo ---------- */
 int main()
@@ -133,20 +21,31 @@ int main()
 
     for (const auto& [name, source] : datasets) {
         string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
         string explored_output = "../map_data/graph_" + name + "_visited_edges_dijk_decKey.txt";
         string path_output = "../map_data/graph_" + name + "_final_nodes_dijk_decKey.txt";
 
         Timer runtime;
-        Graph G = read_graph(input);
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
         int s = source, t = G.size() - 1;
-        vector<int> prev;
-        std::vector<std::pair<int, int>> explored;
-
-        auto dist = dijkstra_dec_key(G, s, t, explored, prev, &runtime);
-        write_edges(explored_output, explored);
-        write_path(path_output, reconstruct_path(prev, t));
-
-        cout << "Shortest distance (" << name << "): " << dist[t] << "\n";
+        bool reachable = may_reach(input, G, s, t);
+        SearchWorkspace ws(G.size());
+
+        // 32-bit heap keys when every distance is an integer below 2^32 (any path has < n edges)
+        WeightInfo info = weight_info(G);
+        bool key32 = info.integral && uint64_t(G.size()) * info.max_weight < UINT32_MAX;
+        auto search = [&](auto&& instr) {
+            if (!reachable)
+                return INF;
+            return key32 ? dijkstra_dary<uint32_t>(G, s, t, ws, instr) : dijkstra_dary(G, s, t, ws, instr);
+        };
+        double dist = timed_then_streamed(runtime, search, explored_output);
+        write_path(path_output, ws.path(t));
+
+        cout << "Shortest distance (" << name << "): " << dist << "\n";
         cout << "Time (" << name << "): " << runtime.elapsed() << " seconds\n";
     }
 }
@@ -0,0 +1,53 @@
+//Delta-stepping: parallel one-to-all search from the source, used here as an isochrone. Every node
+//within the s-t distance is reached, its shortest-path tree edges are written as the visited edges,
+//and the s-t path is read from the same tree.
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "dijk_delta.h"
+#include <iostream>
+#include <bits/stdc++.h>
+
+using namespace std;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        string explored_output = "../map_data/graph_" + name + "_visited_edges_dijk_delta.txt";
+        string path_output = "../map_data/graph_" + name + "_final_nodes_dijk_delta.txt";
+
+        Timer runtime;
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
+        int s = source, t = G.size() - 1;
+        vector<int> prev;
+        double delta = suggest_delta(G);
+        int threads = default_threads();
+
+        runtime.start();
+        auto dist = delta_stepping(G, s, delta, threads, Relaxation::Atomic, &prev);
+        runtime.pause();
+
+        // Isochrone: tree edges of every node at most dist[t] away
+        std::vector<std::pair<int, int>> explored;
+        for (int v = 0; v < (int)G.size(); ++v)
+            if (prev[v] != -1 && dist[v] <= dist[t])
+                explored.push_back({prev[v], v});
+        write_edges(explored_output, explored);
+        write_path(path_output, reconstruct_path(prev, t));
+
+        cout << "Shortest distance (" << name << "): " << dist[t] << "\n";
+        cout << "Time (" << name << "): " << runtime.elapsed() << " seconds (one-to-all, " << threads
+             << " threads, delta " << delta << ")\n";
+        cout << "Isochrone (" << name << "): " << explored.size() + 1 << " nodes within " << dist[t] << "\n";
+    }
+}
@@ -0,0 +1,211 @@
+//Delta-stepping: parallel one-to-all shortest paths. Nodes are kept in buckets of width delta by
+//tentative distance; all nodes of the lowest non-empty bucket are relaxed in parallel (re-running the
+//bucket while relaxations refill it), then the next bucket follows. Larger delta means fewer, bigger
+//phases (more parallelism, more re-relaxations); delta -> 0 degenerates to Dijkstra, delta -> INF to Bellman-Ford.
+#ifndef DIJK_DELTA_H
+#define DIJK_DELTA_H
+
+#include "../helpers/graph_io.h"
+#include "../helpers/parallel.h"
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+// How concurrent relaxations of the same node are resolved
+enum class Relaxation {
+    Atomic,      // compare-and-swap minimum on the shared distance array
+    ThreadLocal  // requests are buffered per owning thread (v % threads) and applied by the owner
+};
+
+// Bucket width for G: a few average edge weights, wide enough to give every thread work in a phase,
+// narrow enough that few nodes are relaxed more than once
+template <typename GraphT>
+double suggest_delta(const GraphT &G)
+{
+    double total = 0;
+    size_t edges = 0;
+    int n = G.size();
+    for (int u = 0; u < n; ++u)
+        for (auto [v, w] : G[u])
+        {
+            total += w;
+            ++edges;
+        }
+    double mean = edges ? total / edges : 1.0;
+    return mean > 0 ? 4 * mean : 1.0;
+}
+
+// Predecessors for final distances, as a sequential Dijkstra records them: nodes are taken in
+// (dist, id) order, the order Dijkstra settles them in, and each node's prev is the first taken node
+// with a tight edge to it. A node reached only through zero-weight edges from equally distant nodes is
+// taken as soon as it gets its prev, which keeps the tree acyclic.
+template <typename GraphT>
+std::vector<int> shortest_path_tree(const GraphT &G, int s, const std::vector<double> &dist)
+{
+    int n = G.size();
+    std::vector<int> order;
+    for (int v = 0; v < n; ++v)
+        if (dist[v] != INF)
+            order.push_back(v);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return dist[a] != dist[b] ? dist[a] < dist[b] : a < b;
+    });
+
+    std::vector<int> prev(n, -1), stack;
+    std::vector<char> passed(n, 0);
+    for (int u : order)
+    {
+        passed[u] = 1;
+        if (u != s && prev[u] == -1)
+            continue; // zero-weight pending: taken once a predecessor shows up
+        stack.push_back(u);
+        while (!stack.empty())
+        {
+            int x = stack.back();
+            stack.pop_back();
+            for (auto [v, w] : G[x])
+                if (v != s && prev[v] == -1 && dist[x] + w == dist[v])
+                {
+                    prev[v] = x;
+                    if (passed[v])
+                        stack.push_back(v);
+                }
+        }
+    }
+    return prev;
+}
+
+// One-to-all distances from s on `threads` threads; prev (optional) as in shortest_path_tree.
+// With integer weights the distances equal the sequential ones exactly; with fractional weights
+// they may differ in the last bit where paths of equal length sum their weights in another order.
+template <typename GraphT>
+std::vector<double> delta_stepping(const GraphT &G, int s, double delta, int threads = default_threads(),
+                                   Relaxation mode = Relaxation::Atomic, std::vector<int> *prev = nullptr)
+{
+    // Non-negative doubles compare like their bit patterns, so the shared array holds bits
+    auto to_bits = [](double d) { uint64_t b; std::memcpy(&b, &d, sizeof b); return b; };
+    auto from_bits = [](uint64_t b) { double d; std::memcpy(&d, &b, sizeof d); return d; };
+    auto bin_of = [delta](double d) { return static_cast<size_t>(d / delta); };
+    const size_t NONE = SIZE_MAX;
+    const size_t CHUNK = 64; // frontier nodes taken per fetch
+
+    int n = G.size();
+    threads = std::max(1, threads);
+    std::vector<std::atomic<uint64_t>> dist(n);
+    parallel_blocks(n, threads, [&](size_t begin, size_t end, int) {
+        for (size_t v = begin; v < end; ++v)
+            dist[v].store(to_bits(INF), std::memory_order_relaxed);
+    });
+    dist[s].store(to_bits(0.0), std::memory_order_relaxed);
+
+    std::vector<int> frontier = {s};
+    size_t curr = 0;
+    std::atomic<size_t> next_item{0}, next_bin{NONE};
+    std::vector<std::vector<std::vector<int>>> bins(threads);   // [thread][bucket] nodes it improved
+    std::vector<std::vector<std::vector<std::pair<int, double>>>> requests(
+        mode == Relaxation::ThreadLocal ? threads : 0, std::vector<std::vector<std::pair<int, double>>>(threads));
+    std::vector<size_t> offsets(threads + 1, 0);
+    SpinBarrier barrier(threads);
+
+    run_threads(threads, [&](int tid) {
+        auto &my_bins = bins[tid];
+        auto push = [&](int v, double d) {
+            size_t b = bin_of(d);
+            if (b >= my_bins.size())
+                my_bins.resize(b + 1);
+            my_bins[b].push_back(v);
+        };
+
+        while (true)
+        {
+            // Relax the edges of every frontier node still in the current bucket
+            for (size_t begin; (begin = next_item.fetch_add(CHUNK, std::memory_order_relaxed)) < frontier.size();)
+            {
+                size_t end = std::min(begin + CHUNK, frontier.size());
+                for (size_t i = begin; i < end; ++i)
+                {
+                    int u = frontier[i];
+                    double du = from_bits(dist[u].load(std::memory_order_relaxed));
+                    if (bin_of(du) != curr)
+                        continue; // settled in an earlier bucket since it was queued
+                    for (auto [v, w] : G[u])
+                    {
+                        double nd = du + w;
+                        uint64_t nb = to_bits(nd), old = dist[v].load(std::memory_order_relaxed);
+                        if (nb >= old)
+                            continue;
+                        if (mode == Relaxation::ThreadLocal)
+                        {
+                            requests[tid][v % threads].push_back({v, nd});
+                            continue;
+                        }
+                        while (nb < old)
+                            if (dist[v].compare_exchange_weak(old, nb, std::memory_order_relaxed))
+                            {
+                                push(v, nd);
+                                break;
+                            }
+                    }
+                }
+            }
+            if (mode == Relaxation::ThreadLocal)
+            {
+                barrier.wait();
+                for (int from = 0; from < threads; ++from)
+                {
+                    for (auto [v, nd] : requests[from][tid])
+                        if (to_bits(nd) < dist[v].load(std::memory_order_relaxed))
+                        {
+                            dist[v].store(to_bits(nd), std::memory_order_relaxed);
+                            push(v, nd);
+                        }
+                    requests[from][tid].clear();
+                }
+            }
+
+            // Next bucket: the lowest non-empty one over all threads (never below curr)
+            size_t mine = NONE;
+            for (size_t b = curr; b < my_bins.size() && mine == NONE; ++b)
+                if (!my_bins[b].empty())
+                    mine = b;
+            for (size_t seen = next_bin.load(); mine < seen && !next_bin.compare_exchange_weak(seen, mine);)
+                ;
+            barrier.wait();
+            size_t nb = next_bin.load();
+            if (nb == NONE)
+                return;
+            offsets[tid + 1] = nb < my_bins.size() ? my_bins[nb].size() : 0;
+            barrier.wait();
+            if (tid == 0)
+            {
+                for (int i = 0; i < threads; ++i)
+                    offsets[i + 1] += offsets[i];
+                frontier.resize(offsets[threads]);
+                curr = nb;
+                next_item = 0;
+                next_bin = NONE;
+            }
+            barrier.wait();
+            if (nb < my_bins.size())
+            {
+                std::copy(my_bins[nb].begin(), my_bins[nb].end(), frontier.begin() + offsets[tid]);
+                my_bins[nb].clear();
+            }
+            barrier.wait();
+        }
+    });
+
+    std::vector<double> d(n);
+    parallel_blocks(n, threads, [&](size_t begin, size_t end, int) {
+        for (size_t v = begin; v < end; ++v)
+            d[v] = from_bits(dist[v].load(std::memory_order_relaxed));
+    });
+    if (prev)
+        *prev = shortest_path_tree(G, s, d);
+    return d;
+}
+
+#endif  // DIJK_DELTA_H
@@ -0,0 +1,56 @@
+#ifndef DIJK_GENERATED_H
+#define DIJK_GENERATED_H
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include <vector>
+#include <queue>
+#include <utility>
+#include <functional>
+
+// Runs in ws and returns dist(s, t) (INF for t = -1, no target)
+template <typename GraphT, typename Instr = NoInstrumentation>
+double run_dijk_generated(const GraphT &G, int s, int t, SearchWorkspace &ws, Instr &&instr = Instr()) {
+    
+    ws.begin(G.size());
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<>> pq;
+    ws.set_dist(s, 0);
+    pq.push({0, s});
+    instr.push();
+
+    while (!pq.empty()) {
+        auto [d, u] = pq.top(); pq.pop();
+        instr.pop();
+        double du = ws.dist(u);
+        if (d > du) { instr.stale_pop(); continue; }
+        instr.settle(u);
+
+        for (const auto& edge : G[u]) {
+            int v = edge.to;
+            double w = edge.w;
+            instr.scan(u, v);
+            if (ws.dist(v) > du + w) {
+                ws.set_dist(v, du + w);
+                ws.set_prev(v, u);
+                instr.relax(v);
+                pq.push({du + w, v});
+                instr.push();
+            }
+        }
+    }
+
+    return t >= 0 ? ws.dist(t) : INF;
+}
+
+template <typename GraphT>
+std::vector<double> run_dijk_generated(const GraphT &G, int s, int t, std::vector<std::pair<int, int>>& explored_edges, std::vector<int>& prev, Timer* timer) {
+    SearchWorkspace ws(G.size());
+    EdgeLog log(explored_edges);
+    timed_then_traced(*timer, [&](auto &&instr) { return run_dijk_generated(G, s, t, ws, instr); }, log);
+    prev = ws.predecessors();
+    return ws.distances();
+}
+
+#endif  // DIJK_GENERATED_H
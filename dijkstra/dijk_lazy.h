@@ -0,0 +1,75 @@
+//Lazy binary-heap Dijkstra: pushes every tentative edge cost into a binary heap and simply ignores outdated entries when popped, 
+//trading extra inserts for simpler code.
+#ifndef DIJK_LAZY_H
+#define DIJK_LAZY_H
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include <vector>
+#include <utility>
+#include <functional>
+#include <algorithm>
+
+// GraphT is Graph or CSRGraphT<W>: anything with size() and an iterable G[u] of {to, w}.
+// Runs in ws (reused across queries, see SearchWorkspace); returns dist(s, t), path via ws.path(t).
+// t = -1 means no target: the search settles everything reachable from s, returns INF, and the
+// distances and tree are read from ws. The other kernels follow the same convention.
+// instr is the instrumentation policy (see instrumentation.h), none by default.
+template <typename GraphT, typename Instr = NoInstrumentation>
+double dijkstra_lazy(const GraphT &G, int s, int t, SearchWorkspace &ws, Instr &&instr = Instr())
+{
+    ws.begin(G.size());
+    auto &pq = ws.queue; // binary heap, same order as std::priority_queue
+    std::greater<SearchWorkspace::QueueEntry> later;
+    ws.set_dist(s, 0);
+    pq.emplace_back(0, s);
+    instr.push();
+
+    while (!pq.empty())
+    {
+        std::pop_heap(pq.begin(), pq.end(), later);
+        auto [d, u] = pq.back();
+        pq.pop_back();
+        instr.pop();
+        if (ws.settled(u))
+        {
+            instr.stale_pop();
+            continue;
+        }
+        ws.settle(u);
+        instr.settle(u);
+        if (u == t)
+            break;
+        for (auto [v, w] : G[u])
+        {
+            instr.scan(u, v);
+            if (!ws.settled(v) && d + w < ws.dist(v))
+            {
+                ws.set_dist(v, d + w);
+                ws.set_prev(v, u);
+                instr.relax(v);
+                pq.emplace_back(d + w, v);
+                std::push_heap(pq.begin(), pq.end(), later);
+                instr.push();
+            }
+        }
+    }
+    return t >= 0 ? ws.dist(t) : INF;
+}
+
+// Classic signature: full dist vector and prev array, every scanned edge appended to explored_edges
+template <typename GraphT>
+std::vector<double> dijkstra_lazy(const GraphT &G, int s, int t, std::vector<std::pair<int, int>>& explored_edges, std::vector<int>& prev, Timer* timer, int* settled_nodes = nullptr)
+{
+    SearchWorkspace ws(G.size());
+    EdgeLog log(explored_edges);
+    timed_then_traced(*timer, [&](auto &&instr) { return dijkstra_lazy(G, s, t, ws, instr); }, log);
+    if (settled_nodes)
+        *settled_nodes = log.counters.settled;
+    prev = ws.predecessors();
+    return ws.distances();
+}
+
+#endif  // DIJK_LAZY_H
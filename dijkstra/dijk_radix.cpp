@@ -0,0 +1,47 @@
+//Integer-key Dijkstra: when every edge weight is a non-negative integer, uses Dial's bucket queue (small maximum
+//weight) or a monotone radix heap instead of a comparison heap; falls back to dijkstra_lazy otherwise.
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/trace_sink.h"
+#include "dijk_radix.h"
+#include <iostream>
+#include <bits/stdc++.h>
+
+using namespace std;
+
+int main()
+{
+    vector<pair<string, int>> datasets = {
+        {"large", 0},
+        {"Netherlands", 60000}
+    };
+
+    for (const auto& [name, source] : datasets) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        string explored_output = "../map_data/graph_" + name + "_visited_edges_dijk_radix.txt";
+        string path_output = "../map_data/graph_" + name + "_final_nodes_dijk_radix.txt";
+
+        Timer runtime;
+        CSRGraph32 G = open_graph(input);  // binary if convert_graph was run
+        int s = source, t = G.size() - 1;
+        bool reachable = may_reach(input, G, s, t);
+        SearchWorkspace ws(G.size());
+
+        WeightInfo info = weight_info(G);
+        cout << "Queue (" << name << "): "
+             << (!info.integral ? "binary heap (non-integer weights)" : use_dial(info) ? "Dial buckets" : "radix heap")
+             << ", max weight " << info.max_weight << "\n";
+
+        auto search = [&](auto&& instr) { return reachable ? dijkstra_integer(G, s, t, info, ws, instr) : INF; };
+        double dist = timed_then_streamed(runtime, search, explored_output);
+        write_path(path_output, ws.path(t));
+
+        cout << "Shortest distance (" << name << "): " << dist << "\n";
+        cout << "Time (" << name << "): " << runtime.elapsed() << " seconds\n";
+    }
+}
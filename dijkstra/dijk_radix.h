@@ -0,0 +1,221 @@
+//Integer-key Dijkstra: when every edge weight is a non-negative integer (rounded meters from generate_data.py),
+//replaces the comparison heap with a monotone radix heap, or with Dial's circular bucket queue when the maximum
+//weight is small, both O(1) amortised per operation instead of O(log n).
+#ifndef DIJK_RADIX_H
+#define DIJK_RADIX_H
+
+#include "../helpers/timer.h"
+#include "../helpers/graph_io.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "dijk_lazy.h"
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+// Largest maximum edge weight for which the Dial queue is picked (one bucket per possible key offset)
+const uint32_t DIAL_MAX_WEIGHT = 1u << 16;
+
+// Monotone radix heap: keys popped are non-decreasing, and every pushed key is >= the last popped one.
+// Bucket i > 0 holds keys whose highest bit differing from `last` is bit i-1; bucket 0 holds key == last.
+class RadixHeap
+{
+public:
+    void push(uint64_t key, int v)
+    {
+        buckets_[bucket_of(key)].push_back({key, v});
+        ++size_;
+    }
+
+    std::pair<uint64_t, int> pop()
+    {
+        if (buckets_[0].empty())
+        {
+            int i = 1;
+            while (buckets_[i].empty())
+                ++i;
+            // New minimum; every entry of bucket i moves to a lower bucket relative to it
+            uint64_t new_last = buckets_[i][0].first;
+            for (auto &e : buckets_[i])
+                if (e.first < new_last)
+                    new_last = e.first;
+            last_ = new_last;
+            for (auto &e : buckets_[i])
+                buckets_[bucket_of(e.first)].push_back(e);
+            buckets_[i].clear();
+        }
+        auto top = buckets_[0].back();
+        buckets_[0].pop_back();
+        --size_;
+        return top;
+    }
+
+    bool empty() const { return size_ == 0; }
+
+    // Drop every entry but keep the bucket storage for the next search
+    void clear()
+    {
+        for (auto &b : buckets_)
+            b.clear();
+        last_ = 0;
+        size_ = 0;
+    }
+
+private:
+    int bucket_of(uint64_t key) const
+    {
+        return key == last_ ? 0 : 64 - __builtin_clzll(key ^ last_);
+    }
+
+    std::vector<std::pair<uint64_t, int>> buckets_[65];
+    uint64_t last_ = 0;
+    size_t size_ = 0;
+};
+
+// Dial's bucket queue: with weights <= C, all live keys lie in [cur, cur + C],
+// so C + 1 circular buckets indexed by key % (C + 1) keep them in order
+class DialQueue
+{
+public:
+    explicit DialQueue(uint32_t max_weight) : buckets_(max_weight + 1) {}
+
+    void push(uint64_t key, int v)
+    {
+        buckets_[key % buckets_.size()].push_back(v);
+        ++size_;
+    }
+
+    std::pair<uint64_t, int> pop()
+    {
+        while (buckets_[cur_ % buckets_.size()].empty())
+            ++cur_;
+        auto &b = buckets_[cur_ % buckets_.size()];
+        int v = b.back();
+        b.pop_back();
+        --size_;
+        return {cur_, v};
+    }
+
+    bool empty() const { return size_ == 0; }
+
+    uint32_t max_weight() const { return static_cast<uint32_t>(buckets_.size() - 1); }
+
+    // Drop every entry but keep the buckets: live keys lie in [cur, cur + C], so at most C + 1
+    // buckets are visited, and only until the last entry is gone
+    void clear()
+    {
+        for (; size_ > 0; ++cur_)
+        {
+            auto &b = buckets_[cur_ % buckets_.size()];
+            size_ -= b.size();
+            b.clear();
+        }
+        cur_ = 0;
+    }
+
+private:
+    std::vector<std::vector<int>> buckets_;
+    uint64_t cur_ = 0;
+    size_t size_ = 0;
+};
+
+// Dial for small maximum weights, radix heap otherwise (see weight_info in graph_io.h)
+inline bool use_dial(const WeightInfo &info)
+{
+    return info.integral && info.max_weight <= DIAL_MAX_WEIGHT;
+}
+
+// Dijkstra over integer keys with any monotone queue offering push(key, v) / pop() / empty() / clear();
+// runs in ws and returns dist(s, t) (INF for t = -1, no target). pq is cleared first, so one queue can serve many queries.
+template <typename Queue, typename GraphT, typename Instr = NoInstrumentation>
+double dijkstra_bucket(const GraphT &G, int s, int t, Queue &pq, SearchWorkspace &ws, Instr &&instr = Instr())
+{
+    ws.begin(G.size()); // distances are integer-valued doubles, exact below 2^53
+    pq.clear();
+    ws.set_dist(s, 0);
+    pq.push(0, s);
+    instr.push();
+
+    while (!pq.empty())
+    {
+        auto [d, u] = pq.pop();
+        instr.pop();
+        if (ws.settled(u))
+        {
+            instr.stale_pop();
+            continue;
+        }
+        ws.settle(u);
+        instr.settle(u);
+        if (u == t)
+            break;
+        for (auto [v, w] : G[u])
+        {
+            instr.scan(u, v);
+            uint64_t nd = d + static_cast<uint64_t>(w);
+            if (!ws.settled(v) && static_cast<double>(nd) < ws.dist(v))
+            {
+                ws.set_dist(v, static_cast<double>(nd));
+                ws.set_prev(v, u);
+                instr.relax(v);
+                pq.push(nd, v);
+                instr.push();
+            }
+        }
+    }
+    return t >= 0 ? ws.dist(t) : INF;
+}
+
+template <typename Queue, typename GraphT>
+std::vector<double> dijkstra_bucket(const GraphT &G, int s, int t, Queue &pq, std::vector<std::pair<int, int>>& explored_edges, std::vector<int>& prev, Timer* timer)
+{
+    SearchWorkspace ws(G.size());
+    EdgeLog log(explored_edges);
+    timed_then_traced(*timer, [&](auto &&instr) { return dijkstra_bucket(G, s, t, pq, ws, instr); }, log);
+    prev = ws.predecessors();
+    return ws.distances();
+}
+
+template <typename GraphT>
+std::vector<double> dijkstra_radix(const GraphT &G, int s, int t, std::vector<std::pair<int, int>>& explored_edges, std::vector<int>& prev, Timer* timer)
+{
+    RadixHeap pq;
+    return dijkstra_bucket(G, s, t, pq, explored_edges, prev, timer);
+}
+
+template <typename GraphT>
+std::vector<double> dijkstra_dial(const GraphT &G, int s, int t, uint32_t max_weight, std::vector<std::pair<int, int>>& explored_edges, std::vector<int>& prev, Timer* timer)
+{
+    DialQueue pq(max_weight); // built outside the timed search, like the workspace
+    return dijkstra_bucket(G, s, t, pq, explored_edges, prev, timer);
+}
+
+// Picks the queue from info: Dial for small integer weights, radix heap for other integer
+// weights, and the comparison-heap dijkstra_lazy when some weight is not an integer.
+// The queue lives in ws, so its buckets are allocated once, not per query.
+template <typename GraphT, typename Instr = NoInstrumentation>
+double dijkstra_integer(const GraphT &G, int s, int t, const WeightInfo &info, SearchWorkspace &ws, Instr &&instr = Instr())
+{
+    if (!info.integral)
+        return dijkstra_lazy(G, s, t, ws, instr);
+    if (use_dial(info))
+    {
+        DialQueue &pq = ws.queue_of<DialQueue>(info.max_weight);
+        if (pq.max_weight() != info.max_weight)
+            pq = DialQueue(info.max_weight);
+        return dijkstra_bucket(G, s, t, pq, ws, instr);
+    }
+    return dijkstra_bucket(G, s, t, ws.queue_of<RadixHeap>(), ws, instr);
+}
+
+template <typename GraphT>
+std::vector<double> dijkstra_integer(const GraphT &G, int s, int t, const WeightInfo &info, std::vector<std::pair<int, int>>& explored_edges, std::vector<int>& prev, Timer* timer)
+{
+    if (!info.integral)
+        return dijkstra_lazy(G, s, t, explored_edges, prev, timer);
+    if (use_dial(info))
+        return dijkstra_dial(G, s, t, info.max_weight, explored_edges, prev, timer);
+    return dijkstra_radix(G, s, t, explored_edges, prev, timer);
+}
+
+#endif  // DIJK_RADIX_H
@@ -7,18 +7,27 @@ REM Create build and statistics folders if not existing
 if not exist ..\build mkdir ..\build
 if not exist ..\statistics mkdir ..\statistics
 
-echo [1/4] Compiling dijk_generated...
+echo [1/7] Compiling dijk_generated...
 g++ -std=c++17 -I..\helpers dijk_generated.cpp ..\helpers\timer.cpp -o ..\build\dijkstra_generated.exe
 
-echo [2/4] Compiling dijk_lazy...
+echo [2/7] Compiling dijk_lazy...
 g++ -std=c++17 -I..\helpers dijk_lazy.cpp ..\helpers\timer.cpp -o ..\build\dijkstra_lazy.exe
 
-echo [3/4] Compiling dijk_decKey...
+echo [3/7] Compiling dijk_decKey...
 g++ -std=c++17 -I..\helpers dijk_decKey.cpp ..\helpers\timer.cpp -o ..\build\dijkstra_decKey.exe
 
-echo [4/4] Compiling dijk_Fib...
+echo [4/7] Compiling dijk_Fib...
 g++ -std=c++17 -I..\helpers -I..\vcpkg\installed\x64-windows\include dijk_Fib.cpp ..\helpers\timer.cpp -o ..\build\dijkstra_fib.exe
 
+echo [5/7] Compiling dijk_bidir...
+g++ -std=c++17 -I..\helpers dijk_bidir.cpp ..\helpers\timer.cpp -o ..\build\dijkstra_bidir.exe
+
+echo [6/7] Compiling dijk_radix...
+g++ -std=c++17 -I..\helpers dijk_radix.cpp ..\helpers\timer.cpp -o ..\build\dijkstra_radix.exe
+
+echo [7/7] Compiling dijk_delta...
+g++ -std=c++17 -I..\helpers dijk_delta.cpp ..\helpers\timer.cpp -o ..\build\dijkstra_delta.exe
+
 echo ==============================
 echo Running All Dijkstra Variants
 echo ==============================
@@ -41,6 +50,21 @@ echo ==============================
 echo Running dijkstra_fib...
 ..\build\dijkstra_fib.exe
 
+echo ==============================
+
+echo Running dijkstra_bidir...
+..\build\dijkstra_bidir.exe
+
+echo ==============================
+
+echo Running dijkstra_radix...
+..\build\dijkstra_radix.exe
+
+echo ==============================
+
+echo Running dijkstra_delta...
+..\build\dijkstra_delta.exe
+
 echo ==============================
 echo ✅ All Dijkstra variants completed.
 echo ==============================
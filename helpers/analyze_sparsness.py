@@ -7,7 +7,7 @@ EDGE_FILE = "../input_edges/graph_" + dataset + "_edges.txt"
 
 
 with open(EDGE_FILE, "r") as f:
-    n, m = map(int, f.readline().split())
+    n, m = map(int, f.readline().split()[:2])  # header may end with "directed"
     out_degree = {}
     all_nodes = set()
 
@@ -0,0 +1,57 @@
+// One-time conversion of the text edge lists (and node coordinates, if present)
+// into the memory-mappable binary format of graph_bin.h, with the component labels
+// (graph_components.h) computed once and stored alongside.
+//
+//   convert_graph                                   converts every dataset below
+//   convert_graph <edges.txt> <out.bin> [nodes.txt] converts a single file
+
+#include "timer.h"
+#include "graph_io.h"
+#include "csr_graph.h"
+#include "graph_bin.h"
+#include "graph_parallel_io.h"
+#include <iostream>
+#include <bits/stdc++.h>
+
+using namespace std;
+
+void convert(const string& input, const string& output, const string& nodes)
+{
+    Timer t;
+    t.start();
+    bool directed = read_graph_header(input).directed;
+    CSRGraph32 G = read_csr_graph_parallel<float>(input);
+    vector<LatLon> coords;
+    bool with_coords = !nodes.empty() && ifstream(nodes);
+    if (with_coords)
+        coords = read_nodes(nodes, G.size());
+    ComponentIndex components = component_index(G, directed);
+    write_graph_bin(output, G, directed, graph_source_stamp(input), with_coords ? &coords : nullptr, &components);
+    t.pause();
+    cout << input << " -> " << output << " (" << G.size() << " nodes, " << G.num_edges() << " arcs, "
+         << (directed ? "directed" : "undirected") << (with_coords ? ", with coordinates" : "") << ") in " << t.elapsed() << " seconds\n";
+    cout << "  " << components.summary() << "\n";
+
+    Timer load;
+    load.start();
+    GraphBin B = load_graph_bin(output);
+    load.pause();
+    cout << "  reload: " << load.elapsed() * 1000 << " ms\n";
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 3) {
+        convert(argv[1], argv[2], argc >= 4 ? argv[3] : "");
+        return 0;
+    }
+
+    for (string name : {"large", "Netherlands"}) {
+        string input = "../input_edges/graph_" + name + "_edges.txt";
+        if (!ifstream(input)) {
+            cout << "Skipping " << name << ": " << input << " not found\n";
+            continue;
+        }
+        convert(input, graph_bin_path(input), "../map_data/graph_" + name + "_nodes.txt");
+    }
+}
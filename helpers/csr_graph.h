@@ -0,0 +1,138 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "graph_io.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <memory>
+
+// Compressed-sparse-row graph: the out-edges of u live in adj[offsets[u] .. offsets[u+1]),
+// so all edges are packed in one array instead of one heap allocation per node.
+// It exposes the same adjacency-range interface as Graph (size(), G[u] iterable
+// over {to, w}), so the search kernels accept either layout unchanged.
+template <typename W>
+struct CSREdge {
+    int to;
+    W w;
+};
+
+template <typename W>
+class CSRGraphT {
+public:
+    using EdgeT = CSREdge<W>;
+
+    // Contiguous view over the out-edges of a single node
+    class EdgeRange {
+    public:
+        EdgeRange(const EdgeT* b, const EdgeT* e) : b_(b), e_(e) {}
+        const EdgeT* begin() const { return b_; }
+        const EdgeT* end() const { return e_; }
+        int size() const { return static_cast<int>(e_ - b_); }
+        bool empty() const { return b_ == e_; }
+
+    private:
+        const EdgeT* b_;
+        const EdgeT* e_;
+    };
+
+    CSRGraphT() : CSRGraphT(std::vector<uint32_t>(1, 0), {}) {}
+
+    // Take ownership of ready-built arrays: offsets has n + 1 entries, offsets[n] == adj.size()
+    CSRGraphT(std::vector<uint32_t> offsets, std::vector<EdgeT> adj) {
+        auto owned = std::make_shared<Owned>();
+        owned->offsets = std::move(offsets);
+        owned->adj = std::move(adj);
+        off_ = owned->offsets.data();
+        adj_ = owned->adj.data();
+        n_ = static_cast<int>(owned->offsets.size()) - 1;
+        m_ = owned->adj.size();
+        storage_ = std::move(owned);
+    }
+
+    // Build from the vector-of-vectors layout, preserving per-node edge order
+    explicit CSRGraphT(const Graph& G) : CSRGraphT(csr_offsets(G), csr_edges(G)) {}
+
+    // View over arrays owned elsewhere (e.g. a memory-mapped file); storage keeps them alive
+    CSRGraphT(std::shared_ptr<const void> storage, const uint32_t* offsets, const EdgeT* adj, int n)
+        : storage_(std::move(storage)), off_(offsets), adj_(adj), n_(n), m_(offsets[n]) {}
+
+    int size() const { return n_; }
+    size_t num_edges() const { return m_; }
+    int degree(int u) const { return static_cast<int>(off_[u + 1] - off_[u]); }
+
+    EdgeRange operator[](int u) const {
+        return {adj_ + off_[u], adj_ + off_[u + 1]};
+    }
+
+    const uint32_t* offsets() const { return off_; }   // n + 1 entries
+    const EdgeT* edges() const { return adj_; }        // num_edges() entries
+
+    // Bytes held by the adjacency arrays
+    size_t memory_bytes() const {
+        return (n_ + 1) * sizeof(uint32_t) + m_ * sizeof(EdgeT);
+    }
+
+private:
+    static std::vector<uint32_t> csr_offsets(const Graph& G) {
+        std::vector<uint32_t> offsets(G.size() + 1, 0);
+        for (size_t u = 0; u < G.size(); ++u)
+            offsets[u + 1] = offsets[u] + static_cast<uint32_t>(G[u].size());
+        return offsets;
+    }
+    static std::vector<EdgeT> csr_edges(const Graph& G) {
+        std::vector<EdgeT> adj;
+        for (const auto& edges : G)
+            for (auto [v, w] : edges)
+                adj.push_back({v, static_cast<W>(w)});
+        return adj;
+    }
+
+    struct Owned {
+        std::vector<uint32_t> offsets;
+        std::vector<EdgeT> adj;
+    };
+
+    // Copies share the same immutable arrays
+    std::shared_ptr<const void> storage_;
+    const uint32_t* off_ = nullptr;
+    const EdgeT* adj_ = nullptr;
+    int n_ = 0;
+    size_t m_ = 0;
+};
+
+using CSRGraph = CSRGraphT<double>;
+using CSRGraph32 = CSRGraphT<float>;   // 8-byte edges, enough for the integer meter weights
+
+// Heap bytes held by the vector-of-vectors layout (ignores allocator headers)
+inline size_t memory_bytes(const Graph& G) {
+    size_t bytes = G.capacity() * sizeof(std::vector<Edge>);
+    for (const auto& edges : G)
+        bytes += edges.capacity() * sizeof(Edge);
+    return bytes;
+}
+
+// Read graph from file straight into CSR form
+template <typename W = double>
+CSRGraphT<W> read_csr_graph(const std::string& filename, EdgeMode mode = EdgeMode::FromHeader) {
+    return CSRGraphT<W>(read_graph(filename, mode));
+}
+
+// Reverse graph: every edge u->v becomes v->u, for backward searches on directed graphs
+template <typename W>
+CSRGraphT<W> reverse_graph(const CSRGraphT<W>& G) {
+    int n = G.size();
+    std::vector<uint32_t> offsets(n + 1, 0);
+    for (size_t i = 0; i < G.num_edges(); ++i)
+        ++offsets[G.edges()[i].to + 1];
+    for (int v = 0; v < n; ++v)
+        offsets[v + 1] += offsets[v];
+    std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    std::vector<CSREdge<W>> adj(G.num_edges());
+    for (int u = 0; u < n; ++u)
+        for (auto [v, w] : G[u])
+            adj[cursor[v]++] = {u, w};
+    return CSRGraphT<W>(std::move(offsets), std::move(adj));
+}
+
+#endif  // CSR_GRAPH_H
@@ -0,0 +1,126 @@
+#ifndef DARY_HEAP_H
+#define DARY_HEAP_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Arity used when a kernel does not pick one: 4 children share a 32-byte key block (double keys)
+const int DARY_HEAP_ARITY = 4;
+
+// Indexed min-heap over vertices 0..N-1 with decrease-key, for any search kernel.
+//  - D children per node: a shallower tree than a binary heap, and a node's children are adjacent
+//  - struct-of-arrays: sift loops compare only the packed keys_ array; vertices move alongside
+//  - hole-based sifting: the moving entry is kept in registers and written once at its final slot,
+//    so each level costs one move (and one pos_ update) instead of a swap
+//  - Key may be uint32_t (integer weights) or float to halve key traffic versus double
+template <typename Key = double, int D = DARY_HEAP_ARITY>
+class DaryHeap
+{
+    static_assert(D >= 2, "heap arity must be at least 2");
+
+public:
+    explicit DaryHeap(int N) : pos_(N, -1) {}
+
+    bool empty() const { return keys_.empty(); }
+    size_t size() const { return keys_.size(); }
+    bool contains(int v) const { return pos_[v] != -1; }
+    int index(int v) const { return pos_[v]; }
+    Key top_key() const { return keys_[0]; }
+    int top() const { return nodes_[0]; }
+
+    void push(int v, Key k)
+    {
+        keys_.push_back(k);
+        nodes_.push_back(v);
+        sift_up(keys_.size() - 1, v, k);
+    }
+
+    // Lower v's key (no-op if v is absent or k is not smaller)
+    void decrease(int v, Key k)
+    {
+        int i = pos_[v];
+        if (i == -1 || !(k < keys_[i]))
+            return;
+        sift_up(i, v, k);
+    }
+
+    void push_or_decrease(int v, Key k)
+    {
+        if (pos_[v] == -1)
+            push(v, k);
+        else
+            decrease(v, k);
+    }
+
+    // Remove and return the minimum as (key, vertex)
+    std::pair<Key, int> pop()
+    {
+        std::pair<Key, int> top{keys_[0], nodes_[0]};
+        pos_[top.second] = -1;
+        Key k = keys_.back();
+        int v = nodes_.back();
+        keys_.pop_back();
+        nodes_.pop_back();
+        if (!keys_.empty())
+            sift_down(0, v, k);
+        return top;
+    }
+
+    // Empty the heap in O(size), keeping the vertex index allocated for the next search
+    void clear()
+    {
+        for (int v : nodes_)
+            pos_[v] = -1;
+        keys_.clear();
+        nodes_.clear();
+    }
+
+private:
+    void place(size_t i, int v, Key k)
+    {
+        keys_[i] = k;
+        nodes_[i] = v;
+        pos_[v] = static_cast<int>(i);
+    }
+
+    void sift_up(size_t i, int v, Key k)
+    {
+        while (i > 0)
+        {
+            size_t p = (i - 1) / D;
+            if (!(k < keys_[p]))
+                break;
+            place(i, nodes_[p], keys_[p]); // parent moves down into the hole
+            i = p;
+        }
+        place(i, v, k);
+    }
+
+    void sift_down(size_t i, int v, Key k)
+    {
+        size_t n = keys_.size();
+        while (true)
+        {
+            size_t first = D * i + 1;
+            if (first >= n)
+                break;
+            size_t last = first + D < n ? first + D : n;
+            size_t m = first;
+            for (size_t c = first + 1; c < last; ++c)
+                if (keys_[c] < keys_[m])
+                    m = c;
+            if (!(keys_[m] < k))
+                break;
+            place(i, nodes_[m], keys_[m]); // smallest child moves up into the hole
+            i = m;
+        }
+        place(i, v, k);
+    }
+
+    std::vector<Key> keys_;  // heap slot -> key
+    std::vector<int> nodes_; // heap slot -> vertex
+    std::vector<int> pos_;   // vertex -> heap slot, -1 if not present
+};
+
+#endif  // DARY_HEAP_H
@@ -73,12 +73,12 @@ for way in all_ways:
 print("Mapping OSM node IDs to 0-based and consecutive IDs...")
 nodes_reindexed = {node_id: id for id, node_id in enumerate(all_nodes)}
 
-print("Write number of nodes, edges, and for each edge reindexed FromID ToID Length into the input file...")
+print("Write number of nodes, edges, the directed flag, and for each edge reindexed FromID ToID Length into the input file...")
 num_nodes = len(nodes_reindexed)
 num_edges = len(edges)
 
 with open(EDGES_TXT, "w") as f:
-    f.write(f"{num_nodes} {num_edges}\n")
+    f.write(f"{num_nodes} {num_edges} directed\n")  # both directions are listed explicitly for two-way roads
     for from_osm, to_osm, length in edges:
         from_id = nodes_reindexed[from_osm]
         to_id = nodes_reindexed[to_osm]
@@ -0,0 +1,142 @@
+#ifndef GEO_HEURISTIC_H
+#define GEO_HEURISTIC_H
+
+#include "graph_io.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Straight-line A* heuristic from node coordinates (edge weights are geodesic meters,
+// see generate_data.py).
+//
+// h(v) = scale * d(v, t), where d is a metric on the coordinates and scale is the smallest
+// w(u,v) / d(u,v) over the graph's edges with d(u,v) > 0. Then h(u) - h(v) <= scale * d(u, v) <= w(u, v)
+// by the triangle inequality, i.e. h is consistent for the weights A* actually adds up, whatever
+// the earth model or measurement error.
+//
+// Metrics (both satisfy the triangle inequality, so both give a consistent h):
+//   Haversine        great-circle distance on the mean-radius sphere (the default)
+//   Equirectangular  Euclidean distance after projecting (lat, lon) -> R * (lat, lon * cos_ref),
+//                    cos_ref = cos(max |lat| over all nodes). Only an approximation of the
+//                    great-circle distance (it can be longer or shorter), but one sqrt instead of
+//                    four trig calls; the scale is calibrated with the same metric.
+//
+// Weights are rounded to whole meters, so an edge between nodes less than half a meter apart
+// has w = 0 (306 such edges in the large graph), which alone would force scale = 0. The endpoints
+// of zero-weight edges are therefore merged (union-find) and every group takes the coordinate of
+// one member: those edges get d = 0, the triangle inequality still holds on the merged points, and
+// the scale is calibrated on the remaining edges. min_weight leaves edges lighter than it out of
+// the scale: a larger, better guiding h, but no longer a proven lower bound, so A* may return
+// longer paths. The default 0 keeps the strict bound.
+const double EARTH_RADIUS_M = 6371008.8;
+
+enum class GeoMetric { Haversine, Equirectangular };
+
+inline double haversine_m(const LatLon& a, const LatLon& b) {
+    const double rad = M_PI / 180.0;
+    double dlat = (b.lat - a.lat) * rad, dlon = (b.lon - a.lon) * rad;
+    double x = std::sin(dlat / 2) * std::sin(dlat / 2) +
+               std::cos(a.lat * rad) * std::cos(b.lat * rad) * std::sin(dlon / 2) * std::sin(dlon / 2);
+    return 2 * EARTH_RADIUS_M * std::asin(std::min(1.0, std::sqrt(x)));
+}
+
+// Per-graph part: coordinates, projection and calibrated scale
+class GeoModel {
+public:
+    template <typename GraphT>
+    GeoModel(const GraphT& G, std::vector<LatLon> coords, GeoMetric metric = GeoMetric::Haversine,
+             double min_weight = 0.0)
+        : coords_(std::move(coords)), metric_(metric) {
+        merge_zero_weight_edges(G);
+        double max_lat = 0;
+        for (const LatLon& c : coords_)
+            max_lat = std::max(max_lat, std::fabs(c.lat));
+        cos_ref_ = std::cos(max_lat * M_PI / 180.0);
+        if (metric_ == GeoMetric::Equirectangular) {
+            xy_.resize(coords_.size());
+            for (size_t v = 0; v < coords_.size(); ++v)
+                xy_[v] = project(coords_[v]);
+        }
+
+        scale_ = INF;
+        int n = G.size();
+        for (int u = 0; u < n; ++u)
+            for (auto [v, w] : G[u]) {
+                double d = distance(u, v);
+                if (w >= min_weight && d > 0)
+                    scale_ = std::min(scale_, w / d);
+            }
+        if (scale_ == INF)
+            scale_ = 0;
+    }
+
+    // Metric distance between two nodes, in meters (before scaling)
+    double distance(int u, int v) const {
+        if (metric_ == GeoMetric::Haversine)
+            return haversine_m(coords_[u], coords_[v]);
+        return std::hypot(xy_[u].lat - xy_[v].lat, xy_[u].lon - xy_[v].lon);
+    }
+
+    // h(v) towards t without a cache: scale * distance, and no metric evaluation at all when scale is 0
+    double bound(int v, int t) const { return scale_ > 0 ? scale_ * distance(v, t) : 0.0; }
+
+    double scale() const { return scale_; }
+    double cos_ref() const { return cos_ref_; }
+    GeoMetric metric() const { return metric_; }
+    int size() const { return coords_.size(); }
+
+private:
+    // Give all nodes joined by zero-weight edges the coordinate of their group's root
+    template <typename GraphT>
+    void merge_zero_weight_edges(const GraphT& G) {
+        int n = std::min<int>(G.size(), coords_.size());
+        std::vector<int> parent(n);
+        for (int v = 0; v < n; ++v)
+            parent[v] = v;
+        auto find = [&](int v) {
+            while (parent[v] != v)
+                v = parent[v] = parent[parent[v]];
+            return v;
+        };
+        for (int u = 0; u < n; ++u)
+            for (auto [v, w] : G[u])
+                if (w <= 0 && v < n)
+                    parent[find(u)] = find(v);
+        for (int v = 0; v < n; ++v)
+            coords_[v] = coords_[find(v)];
+    }
+
+    LatLon project(const LatLon& c) const {
+        const double rad = M_PI / 180.0;
+        return {EARTH_RADIUS_M * c.lat * rad, EARTH_RADIUS_M * c.lon * rad * cos_ref_};
+    }
+
+    std::vector<LatLon> coords_;
+    std::vector<LatLon> xy_;    // projected meters, Equirectangular only
+    GeoMetric metric_;
+    double cos_ref_ = 1;
+    double scale_ = 0;
+};
+
+// Per-query part: h(v) towards goal t, computed on first use and cached for the rest of the query.
+// With scale 0 (no usable edges) h is 0 everywhere and neither trig nor the cache is touched.
+class GeoHeuristic {
+public:
+    GeoHeuristic(const GeoModel& model, int t)
+        : model_(model), t_(t), cache_(model.scale() > 0 ? model.size() : 0, -1.0) {}
+
+    double operator()(int v) const {
+        if (cache_.empty())
+            return 0.0;
+        if (cache_[v] < 0)
+            cache_[v] = model_.bound(v, t_);
+        return cache_[v];
+    }
+
+private:
+    const GeoModel& model_;
+    int t_;
+    mutable std::vector<double> cache_;  // -1 = not computed yet
+};
+
+#endif  // GEO_HEURISTIC_H
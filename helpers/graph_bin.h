@@ -0,0 +1,250 @@
+#ifndef GRAPH_BIN_H
+#define GRAPH_BIN_H
+
+#include "graph_io.h"
+#include "csr_graph.h"
+#include "graph_components.h"
+#include "graph_parallel_io.h"
+#include "mapped_file.h"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Binary graph file (little-endian), written once by convert_graph and then memory-mapped:
+//
+//   GraphBinHeader                       128 bytes
+//   uint32_t offsets[num_nodes + 1]      CSR offsets
+//   CSREdge<float> edges[num_edges]      packed {int32 to, float32 w}, i.e. CSRGraph32's layout
+//   LatLon coords[num_nodes]             only if GRAPH_BIN_HAS_COORDS
+//   int32_t weak[num_nodes],             only if GRAPH_BIN_HAS_COMPONENTS: component labels
+//           strong[num_nodes]            (see graph_components.h)
+//
+// Every section starts on a 64-byte boundary so the mapped arrays are used in place.
+//
+// The header also records the size and modification time of the text file it was converted from.
+// The open_* helpers use the binary file only while both still match (graph_bin_up_to_date), so a
+// dataset regenerated by generate_data.py is parsed again instead of silently loading the old graph.
+const char GRAPH_BIN_MAGIC[8] = {'D', 'V', 'A', 'G', 'R', 'A', 'P', 'H'};
+const uint32_t GRAPH_BIN_VERSION = 2;  // 2: source file stamp, 128-byte header
+const uint32_t GRAPH_BIN_HAS_COORDS = 1u << 0;
+const uint32_t GRAPH_BIN_DIRECTED = 1u << 1;     // edges were stored as given, not mirrored
+const uint32_t GRAPH_BIN_HAS_COMPONENTS = 1u << 2;
+
+struct GraphBinHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t num_nodes;
+    uint64_t num_edges;
+    uint64_t offsets_pos;
+    uint64_t edges_pos;
+    uint64_t coords_pos;      // 0 if no coordinates
+    uint64_t components_pos;  // 0 if no component labels
+    uint64_t source_size;     // text file the graph was converted from, see graph_source_stamp
+    int64_t source_mtime;
+    uint64_t reserved[6];
+};
+static_assert(sizeof(GraphBinHeader) == 128, "binary graph header must stay 128 bytes");
+static_assert(sizeof(CSREdge<float>) == 8, "binary edge record must be 8 bytes");
+
+// A loaded binary graph; coords (if present) live as long as graph does
+struct GraphBin {
+    CSRGraph32 graph;
+    const LatLon* coords = nullptr;
+    const int32_t* weak = nullptr;    // component labels, both or neither
+    const int32_t* strong = nullptr;
+    bool directed = false;
+
+    bool has_coords() const { return coords != nullptr; }
+    bool has_components() const { return weak != nullptr; }
+};
+
+inline uint64_t graph_bin_align(uint64_t pos) {
+    return (pos + 63) & ~uint64_t(63);
+}
+
+// Size and modification time (file clock ticks) of a text graph; all zero if it cannot be read
+struct GraphSourceStamp {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+
+    bool operator==(const GraphSourceStamp& o) const { return size == o.size && mtime == o.mtime; }
+};
+
+inline GraphSourceStamp graph_source_stamp(const std::string& text_filename) {
+    std::error_code ec;
+    GraphSourceStamp stamp;
+    auto size = std::filesystem::file_size(text_filename, ec);
+    if (ec)
+        return stamp;
+    auto mtime = std::filesystem::last_write_time(text_filename, ec);
+    if (ec)
+        return stamp;
+    stamp.size = size;
+    stamp.mtime = static_cast<int64_t>(mtime.time_since_epoch().count());
+    return stamp;
+}
+
+// Write G (and optionally one coordinate per node and its component labels) in the binary format;
+// source is the stamp of the text file G was read from
+inline void write_graph_bin(const std::string& filename, const CSRGraph32& G, bool directed,
+                            const GraphSourceStamp& source,
+                            const std::vector<LatLon>* coords = nullptr,
+                            const ComponentIndex* components = nullptr) {
+    GraphBinHeader hdr{};
+    std::memcpy(hdr.magic, GRAPH_BIN_MAGIC, sizeof(hdr.magic));
+    hdr.version = GRAPH_BIN_VERSION;
+    hdr.source_size = source.size;
+    hdr.source_mtime = source.mtime;
+    if (directed)
+        hdr.flags |= GRAPH_BIN_DIRECTED;
+    hdr.num_nodes = G.size();
+    hdr.num_edges = G.num_edges();
+    hdr.offsets_pos = graph_bin_align(sizeof(GraphBinHeader));
+    hdr.edges_pos = graph_bin_align(hdr.offsets_pos + (hdr.num_nodes + 1) * sizeof(uint32_t));
+    uint64_t end = hdr.edges_pos + hdr.num_edges * sizeof(CSREdge<float>);
+    if (coords) {
+        hdr.flags |= GRAPH_BIN_HAS_COORDS;
+        hdr.coords_pos = graph_bin_align(end);
+        end = hdr.coords_pos + hdr.num_nodes * sizeof(LatLon);
+    }
+    if (components) {
+        hdr.flags |= GRAPH_BIN_HAS_COMPONENTS;
+        hdr.components_pos = graph_bin_align(end);
+    }
+
+    std::ofstream out(filename, std::ios::binary);
+    auto pad_to = [&](uint64_t pos) {
+        static const char zeros[64] = {};
+        out.write(zeros, static_cast<std::streamsize>(pos - static_cast<uint64_t>(out.tellp())));
+    };
+    out.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+    pad_to(hdr.offsets_pos);
+    out.write(reinterpret_cast<const char*>(G.offsets()), (hdr.num_nodes + 1) * sizeof(uint32_t));
+    pad_to(hdr.edges_pos);
+    out.write(reinterpret_cast<const char*>(G.edges()), hdr.num_edges * sizeof(CSREdge<float>));
+    if (coords) {
+        pad_to(hdr.coords_pos);
+        out.write(reinterpret_cast<const char*>(coords->data()), hdr.num_nodes * sizeof(LatLon));
+    }
+    if (components) {
+        pad_to(hdr.components_pos);
+        out.write(reinterpret_cast<const char*>(components->weak.data()), hdr.num_nodes * sizeof(int32_t));
+        out.write(reinterpret_cast<const char*>(components->strong.data()), hdr.num_nodes * sizeof(int32_t));
+    }
+    if (!out)
+        throw std::runtime_error("cannot write " + filename);
+}
+
+// Memory-map a binary graph; the returned arrays point straight into the mapping
+inline GraphBin load_graph_bin(const std::string& filename) {
+    auto file = std::make_shared<MappedFile>(filename);
+    if (file->size() < sizeof(GraphBinHeader))
+        throw std::runtime_error(filename + ": truncated header");
+    GraphBinHeader hdr;
+    std::memcpy(&hdr, file->data(), sizeof(hdr));
+    if (std::memcmp(hdr.magic, GRAPH_BIN_MAGIC, sizeof(hdr.magic)) != 0 || hdr.version != GRAPH_BIN_VERSION)
+        throw std::runtime_error(filename + ": not a binary graph (or wrong version)");
+
+    uint64_t end = hdr.edges_pos + hdr.num_edges * sizeof(CSREdge<float>);
+    if (hdr.flags & GRAPH_BIN_HAS_COORDS)
+        end = hdr.coords_pos + hdr.num_nodes * sizeof(LatLon);
+    if (hdr.flags & GRAPH_BIN_HAS_COMPONENTS)
+        end = hdr.components_pos + 2 * hdr.num_nodes * sizeof(int32_t);
+    if (file->size() < end)
+        throw std::runtime_error(filename + ": truncated data");
+
+    const char* base = file->data();
+    GraphBin result{CSRGraph32(file,
+                               reinterpret_cast<const uint32_t*>(base + hdr.offsets_pos),
+                               reinterpret_cast<const CSREdge<float>*>(base + hdr.edges_pos),
+                               static_cast<int>(hdr.num_nodes))};
+    if (hdr.flags & GRAPH_BIN_HAS_COORDS)
+        result.coords = reinterpret_cast<const LatLon*>(base + hdr.coords_pos);
+    if (hdr.flags & GRAPH_BIN_HAS_COMPONENTS) {
+        result.weak = reinterpret_cast<const int32_t*>(base + hdr.components_pos);
+        result.strong = result.weak + hdr.num_nodes;
+    }
+    result.directed = (hdr.flags & GRAPH_BIN_DIRECTED) != 0;
+    return result;
+}
+
+// "../input_edges/graph_x_edges.txt" -> "../input_edges/graph_x_edges.bin"
+inline std::string graph_bin_path(const std::string& text_filename) {
+    std::string base = text_filename;
+    size_t dot = base.rfind('.');
+    if (dot != std::string::npos && base.find('/', dot) == std::string::npos)
+        base.erase(dot);
+    return base + ".bin";
+}
+
+// Whether convert_graph produced a binary file for this edge list, in the current format, from the
+// text file as it is now (same size and modification time)
+inline bool graph_bin_up_to_date(const std::string& text_filename) {
+    std::ifstream in(graph_bin_path(text_filename), std::ios::binary);
+    GraphBinHeader hdr{};
+    if (!in.read(reinterpret_cast<char*>(&hdr), sizeof(hdr)))
+        return false;
+    if (std::memcmp(hdr.magic, GRAPH_BIN_MAGIC, sizeof(hdr.magic)) != 0 || hdr.version != GRAPH_BIN_VERSION)
+        return false;
+    GraphSourceStamp source = graph_source_stamp(text_filename);
+    return source.size != 0 && source == GraphSourceStamp{hdr.source_size, hdr.source_mtime};
+}
+
+// Load the binary version of an edge-list file if convert_graph produced an up-to-date one
+// (and it was stored with the requested directedness), otherwise parse the text file in parallel
+inline CSRGraph32 open_graph(const std::string& text_filename, EdgeMode mode = EdgeMode::FromHeader) {
+    std::string bin = graph_bin_path(text_filename);
+    if (graph_bin_up_to_date(text_filename)) {
+        GraphBin B = load_graph_bin(bin);
+        if (mode == EdgeMode::FromHeader || B.directed == (mode == EdgeMode::Directed))
+            return B.graph;
+    }
+    return read_csr_graph_parallel<float>(text_filename, default_threads(), mode);
+}
+
+// Node coordinates for an edge-list file: from its up-to-date binary graph if convert_graph stored
+// them, otherwise from the nodes file (empty if neither exists)
+inline std::vector<LatLon> open_coords(const std::string& text_filename, const std::string& nodes_filename, int n) {
+    std::string bin = graph_bin_path(text_filename);
+    if (graph_bin_up_to_date(text_filename)) {
+        GraphBin B = load_graph_bin(bin);
+        if (B.has_coords() && B.graph.size() == n)
+            return std::vector<LatLon>(B.coords, B.coords + n);
+    }
+    if (!std::ifstream(nodes_filename))
+        return {};
+    return read_nodes(nodes_filename, n);
+}
+
+// Component labels of G (loaded from text_filename): from its up-to-date binary graph if convert_graph
+// stored them for the same graph and directedness, otherwise computed (O(n + m))
+inline ComponentIndex open_components(const std::string& text_filename, const CSRGraph32& G, bool directed) {
+    std::string bin = graph_bin_path(text_filename);
+    if (graph_bin_up_to_date(text_filename)) {
+        GraphBin B = load_graph_bin(bin);
+        if (B.has_components() && B.directed == directed && B.graph.size() == G.size()) {
+            ComponentIndex index;
+            index.directed = directed;
+            index.weak.assign(B.weak, B.weak + G.size());
+            index.strong.assign(B.strong, B.strong + G.size());
+            index.count_sizes();
+            return index;
+        }
+    }
+    return component_index(G, directed);
+}
+
+// Whether t may be reachable from s in G (loaded from text_filename with its header's directedness),
+// by the component labels of open_components. false means no s-t path exists, so the mains skip the
+// search for an unreachable t instead of exhausting s's whole component.
+inline bool may_reach(const std::string& text_filename, const CSRGraph32& G, int s, int t) {
+    return open_components(text_filename, G, read_graph_header(text_filename).directed).may_reach(s, t);
+}
+
+#endif  // GRAPH_BIN_H
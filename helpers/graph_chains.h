@@ -0,0 +1,335 @@
+#ifndef GRAPH_CHAINS_H
+#define GRAPH_CHAINS_H
+
+#include "graph_io.h"
+#include "csr_graph.h"
+#include "graph_order.h"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Degree-2 chain compression. Most road graph nodes are polyline points between two neighbours
+// (statistics/sparsness.txt); a search settles them one by one although nothing is decided there.
+// compress_chains collapses every maximal chain of such nodes into one arc between its two end nodes
+// (the core nodes), weighted with the chain length.
+//
+// v is a chain interior when it has exactly two distinct neighbours a, b and every arc through it
+// passes straight on: a -> v -> b, b -> v -> a, or both (each direction of a two-way road is its own
+// chain). In a cycle made of interior nodes only, one node is kept as a core node.
+//
+// Compressed ids put the core nodes first (ids < core_size(), in their input order) and the
+// interiors after them; core has a row for every node, empty for interiors, so per-node tables
+// (landmarks, coordinates) carry over with permute_values(values, order). A query whose source or
+// target is an interior node runs on query(s, t), which attaches it to its chain ends; expand() turns
+// the path found back into input ids, chains included.
+
+// A graph with a few extra arcs for one query, over a base graph that must outlive it. Kernels see
+// the usual size() / G[u] interface.
+template <typename W>
+class ChainQueryGraph {
+public:
+    using EdgeRange = typename CSRGraphT<W>::EdgeRange;
+
+    ChainQueryGraph(const CSRGraphT<W>& base, const std::vector<std::pair<int, CSREdge<W>>>& arcs)
+        : base_(&base) {
+        for (const auto& [u, e] : arcs) {
+            auto it = std::find_if(patches_.begin(), patches_.end(), [u = u](const Patch& p) { return p.node == u; });
+            if (it == patches_.end()) {
+                EdgeRange row = base[u];
+                patches_.push_back({u, std::vector<CSREdge<W>>(row.begin(), row.end())});
+                it = patches_.end() - 1;
+            }
+            it->edges.push_back(e);
+        }
+    }
+
+    int size() const { return base_->size(); }
+
+    EdgeRange operator[](int u) const {
+        for (const Patch& p : patches_)  // at most three
+            if (p.node == u)
+                return {p.edges.data(), p.edges.data() + p.edges.size()};
+        return (*base_)[u];
+    }
+
+private:
+    struct Patch {
+        int node;
+        std::vector<CSREdge<W>> edges;  // the base row plus the query's arcs
+    };
+
+    const CSRGraphT<W>* base_;
+    std::vector<Patch> patches_;
+};
+
+template <typename W>
+struct ChainGraphT {
+    struct Chain {
+        int from, to;    // core ends, compressed ids
+        W length;
+        uint32_t first;  // interiors are nodes[first, first + count), in travel order
+        uint32_t count;
+    };
+
+    // One chain through an interior node; every interior lies on one chain, or two for a two-way road
+    struct ChainPos {
+        int chain = -1;
+        uint32_t index = 0;  // position among the chain's interiors
+    };
+
+    NodeOrder order;             // input <-> compressed ids
+    int core_nodes = 0;
+    CSRGraphT<W> core;           // compressed ids: chains as single arcs, interior rows empty
+    std::vector<int> arc_chain;  // per core arc (index into core.edges()): its chain, -1 for an input arc
+    std::vector<Chain> chains;
+    std::vector<int> nodes;      // chain interiors, compressed ids
+    std::vector<W> prefix;       // per entry of nodes: distance from the chain's from node
+    std::vector<ChainPos> pos;   // two per node (compressed id), chain -1 when unused
+
+    int size() const { return core.size(); }
+    int core_size() const { return core_nodes; }
+    bool interior(int v) const { return v >= core_nodes; }
+
+    // Core nodes that interior v reaches along its chains, with the distance
+    std::vector<std::pair<int, W>> exits(int v) const {
+        std::vector<std::pair<int, W>> out;
+        for (int i = 0; i < 2; ++i)
+            if (const ChainPos& p = pos[2 * v + i]; p.chain >= 0)
+                out.push_back({chains[p.chain].to, chains[p.chain].length - at(p)});
+        return out;
+    }
+
+    // Core nodes from which interior v is reached along its chains, with the distance
+    std::vector<std::pair<int, W>> entries(int v) const {
+        std::vector<std::pair<int, W>> out;
+        for (int i = 0; i < 2; ++i)
+            if (const ChainPos& p = pos[2 * v + i]; p.chain >= 0)
+                out.push_back({chains[p.chain].from, at(p)});
+        return out;
+    }
+
+    // Distance from interior s to interior t without leaving their chain (INF if t is not ahead of s)
+    double direct(int s, int t) const {
+        double best = INF;
+        for (int i = 0; i < 2; ++i)
+            for (int j = 0; j < 2; ++j) {
+                const ChainPos &p = pos[2 * s + i], &q = pos[2 * t + j];
+                if (p.chain >= 0 && p.chain == q.chain && q.index > p.index)
+                    best = std::min(best, double(at(q)) - at(p));
+            }
+        return best;
+    }
+
+    // Graph for the query s -> t (compressed ids): core plus the arcs attaching interior endpoints
+    ChainQueryGraph<W> query(int s, int t) const { return ChainQueryGraph<W>(core, attach(s, t, false)); }
+
+    // The same for the backward search of a bidirectional kernel; R = reverse_graph(core)
+    ChainQueryGraph<W> reverse_query(const CSRGraphT<W>& R, int s, int t) const {
+        return ChainQueryGraph<W>(R, attach(s, t, true));
+    }
+
+    // dist(s, t) from a point-to-point oracle that only knows core nodes (e.g. a CH query on core):
+    // the cheapest combination of chain ends, or the chain itself when t lies ahead of s on it
+    template <typename CoreDistance>
+    double distance(int s, int t, CoreDistance&& core_distance) const {
+        if (s == t)
+            return 0;
+        std::vector<std::pair<int, W>> from = interior(s) ? exits(s) : std::vector<std::pair<int, W>>{{s, 0}};
+        std::vector<std::pair<int, W>> to = interior(t) ? entries(t) : std::vector<std::pair<int, W>>{{t, 0}};
+        double best = interior(s) && interior(t) ? direct(s, t) : INF;
+        for (auto [b, wb] : from)
+            for (auto [a, wa] : to)
+                best = std::min(best, wb + core_distance(b, a) + wa);
+        return best;
+    }
+
+    // A path found on core or query(s, t), in input ids with every chain's interiors put back
+    std::vector<int> expand(const std::vector<int>& path) const {
+        std::vector<int> out;
+        for (size_t i = 0; i < path.size(); ++i) {
+            if (i > 0)
+                append_hop(path[i - 1], path[i], out);
+            out.push_back(order.to_old[path[i]]);
+        }
+        return out;
+    }
+
+private:
+    W at(const ChainPos& p) const { return prefix[chains[p.chain].first + p.index]; }
+
+    std::vector<std::pair<int, CSREdge<W>>> attach(int s, int t, bool reverse) const {
+        std::vector<std::pair<int, CSREdge<W>>> arcs;
+        auto add = [&](int u, int v, W w) {
+            if (reverse)
+                arcs.push_back({v, {u, w}});
+            else
+                arcs.push_back({u, {v, w}});
+        };
+        if (interior(s))
+            for (auto [b, w] : exits(s))
+                add(s, b, w);
+        if (interior(t))
+            for (auto [a, w] : entries(t))
+                add(a, t, w);
+        if (interior(s) && interior(t) && direct(s, t) < INF)
+            add(s, t, static_cast<W>(direct(s, t)));
+        return arcs;
+    }
+
+    // Appends the interiors passed between consecutive path nodes u and v, taking the cheapest of
+    // the ways from u to v (a core arc, or the part of a chain an interior endpoint was attached by)
+    void append_hop(int u, int v, std::vector<int>& out) const {
+        int chain = -1;
+        uint32_t lo = 0, hi = 0;
+        double best = INF;
+        auto consider = [&](int c, uint32_t a, uint32_t b, double cost) {
+            if (cost < best) {
+                best = cost;
+                chain = c;
+                lo = a;
+                hi = b;
+            }
+        };
+        if (!interior(u) && !interior(v)) {
+            for (uint32_t i = core.offsets()[u]; i < core.offsets()[u + 1]; ++i)
+                if (core.edges()[i].to == v) {
+                    int c = arc_chain[i];
+                    consider(c, 0, c >= 0 ? chains[c].count : 0, core.edges()[i].w);
+                }
+        } else if (!interior(u)) {  // core node -> interior target
+            for (int j = 0; j < 2; ++j)
+                if (const ChainPos& q = pos[2 * v + j]; q.chain >= 0 && chains[q.chain].from == u)
+                    consider(q.chain, 0, q.index, at(q));
+        } else {  // interior source -> core node or interior target
+            for (int i = 0; i < 2; ++i) {
+                const ChainPos& p = pos[2 * u + i];
+                if (p.chain < 0)
+                    continue;
+                const Chain& c = chains[p.chain];
+                if (!interior(v) && c.to == v)
+                    consider(p.chain, p.index + 1, c.count, double(c.length) - at(p));
+                for (int j = 0; interior(v) && j < 2; ++j)
+                    if (const ChainPos& q = pos[2 * v + j]; q.chain == p.chain && q.index > p.index)
+                        consider(p.chain, p.index + 1, q.index, double(at(q)) - at(p));
+            }
+        }
+        if (chain >= 0)
+            for (uint32_t k = lo; k < hi; ++k)
+                out.push_back(order.to_old[nodes[chains[chain].first + k]]);
+    }
+};
+
+using ChainGraph32 = ChainGraphT<float>;
+
+template <typename W>
+ChainGraphT<W> compress_chains(const CSRGraphT<W>& G) {
+    int n = G.size();
+    CSRGraphT<W> R = reverse_graph(G);
+    auto has = [](const typename CSRGraphT<W>::EdgeRange& row, int x) {
+        for (auto [y, w] : row)
+            if (y == x)
+                return true;
+        return false;
+    };
+
+    std::vector<char> interior(n, 0);
+    for (int v = 0; v < n; ++v) {
+        if (G.degree(v) == 0 || G.degree(v) > 2 || R.degree(v) > 2)
+            continue;
+        int nb[2], k = 0;
+        bool ok = true;
+        auto note = [&](int x) {
+            if (x == v || (k == 2 && x != nb[0] && x != nb[1]))
+                ok = false;
+            else if (k < 2 && (k == 0 || x != nb[0]))
+                nb[k++] = x;
+        };
+        for (auto [x, w] : G[v])
+            note(x);
+        for (auto [x, w] : R[v])
+            note(x);
+        if (!ok || k != 2)
+            continue;
+        bool out_a = has(G[v], nb[0]), out_b = has(G[v], nb[1]);
+        bool in_a = has(R[v], nb[0]), in_b = has(R[v], nb[1]);
+        // pass-through arcs only, and no parallel arcs
+        interior[v] = in_a == out_b && in_b == out_a && G.degree(v) == out_a + out_b && R.degree(v) == in_a + in_b;
+    }
+
+    // The arc leaving interior v that does not lead back to prev
+    auto next = [&](int v, int prev) {
+        for (auto [x, w] : G[v])
+            if (x != prev)
+                return std::pair<int, W>{x, w};
+        return std::pair<int, W>{-1, 0};
+    };
+    std::vector<char> reached(n, 0);
+    auto mark = [&](int u) {
+        for (auto [x, w] : G[u])
+            for (int prev = u, v = x; interior[v] && !reached[v];) {
+                reached[v] = 1;
+                int from = prev;
+                prev = v;
+                v = next(v, from).first;
+            }
+    };
+    for (int u = 0; u < n; ++u)
+        if (!interior[u])
+            mark(u);
+    for (int v = 0; v < n; ++v)
+        if (interior[v] && !reached[v]) {  // a cycle of interiors
+            interior[v] = 0;
+            mark(v);
+        }
+
+    ChainGraphT<W> C;
+    std::vector<int> sequence;
+    sequence.reserve(n);
+    for (int pass = 0; pass < 2; ++pass)
+        for (int v = 0; v < n; ++v)
+            if (interior[v] == pass)
+                sequence.push_back(v);
+    C.order = NodeOrder::from_sequence(std::move(sequence));
+    C.core_nodes = static_cast<int>(std::count(interior.begin(), interior.end(), 0));
+    C.pos.assign(2 * size_t(n), {});
+
+    std::vector<uint32_t> offsets(n + 1, 0);
+    std::vector<CSREdge<W>> adj;
+    for (int u = 0; u < C.core_nodes; ++u) {
+        int orig = C.order.to_old[u];
+        for (auto [v, w] : G[orig]) {
+            if (!interior[v]) {
+                adj.push_back({C.order.to_new[v], w});
+                C.arc_chain.push_back(-1);
+                continue;
+            }
+            typename ChainGraphT<W>::Chain chain{u, -1, 0, static_cast<uint32_t>(C.nodes.size()), 0};
+            int id = static_cast<int>(C.chains.size());
+            double length = w;
+            int prev = orig;
+            while (interior[v]) {
+                int cv = C.order.to_new[v];
+                C.pos[2 * cv + (C.pos[2 * cv].chain >= 0)] = {id, chain.count++};
+                C.nodes.push_back(cv);
+                C.prefix.push_back(static_cast<W>(length));
+                auto [x, wx] = next(v, prev);
+                length += wx;
+                prev = v;
+                v = x;
+            }
+            chain.to = C.order.to_new[v];
+            chain.length = static_cast<W>(length);
+            C.chains.push_back(chain);
+            adj.push_back({chain.to, chain.length});
+            C.arc_chain.push_back(id);
+        }
+        offsets[u + 1] = static_cast<uint32_t>(adj.size());
+    }
+    for (int u = C.core_nodes; u < n; ++u)
+        offsets[u + 1] = offsets[u];
+    C.core = CSRGraphT<W>(std::move(offsets), std::move(adj));
+    return C;
+}
+
+#endif  // GRAPH_CHAINS_H
@@ -0,0 +1,228 @@
+#ifndef GRAPH_COMPONENTS_H
+#define GRAPH_COMPONENTS_H
+
+#include "csr_graph.h"
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Connected components, for rejecting unreachable queries before searching: otherwise a kernel
+// settles the whole component of s before it returns INF (the Netherlands extract is disconnected,
+// see output_maps/unconnected_netherlands.png).
+//
+//   weak    components of the graph with arc directions ignored; t is unreachable from s when they
+//           differ (for undirected graphs, where every edge is stored both ways, this is exact)
+//   strong  strongly connected components, numbered in topological order of the condensation: every
+//           arc u -> v has strong[u] <= strong[v], so t is unreachable when strong[s] > strong[t] and
+//           certainly reachable when they are equal. Undirected graphs have strong == weak.
+struct ComponentIndex {
+    bool directed = false;
+    std::vector<int> weak, strong;            // per node
+    std::vector<int> weak_size, strong_size;  // per component
+
+    int num_weak() const { return static_cast<int>(weak_size.size()); }
+    int num_strong() const { return static_cast<int>(strong_size.size()); }
+
+    // false: no s -> t path exists; true: a search is needed (for undirected graphs: a path exists)
+    bool may_reach(int s, int t) const {
+        return weak[s] == weak[t] && (!directed || strong[s] <= strong[t]);
+    }
+
+    int largest_weak() const { return largest(weak_size); }
+    int largest_strong() const { return largest(strong_size); }
+
+    // "1 weak / 12 strong components, largest 93294 nodes (100.0%), largest strong 93270 nodes (100.0%)"
+    std::string summary() const {
+        std::ostringstream out;
+        auto share = [&](const std::vector<int>& size, int c) {
+            out << size[c] << " nodes (" << std::fixed << std::setprecision(1) << 100.0 * size[c] / weak.size() << "%)";
+        };
+        out << num_weak() << " weak";
+        if (directed)
+            out << " / " << num_strong() << " strong";
+        out << " components";
+        if (weak.empty())
+            return out.str();
+        out << ", largest ";
+        share(weak_size, largest_weak());
+        if (directed) {
+            out << ", largest strong ";
+            share(strong_size, largest_strong());
+        }
+        return out.str();
+    }
+
+    // Component sizes from the labels (after loading them from a binary graph)
+    void count_sizes() {
+        weak_size = sizes(weak);
+        strong_size = sizes(strong);
+    }
+
+private:
+    static int largest(const std::vector<int>& size) {
+        return static_cast<int>(std::max_element(size.begin(), size.end()) - size.begin());
+    }
+    static std::vector<int> sizes(const std::vector<int>& label) {
+        std::vector<int> size;
+        for (int c : label) {
+            if (c >= static_cast<int>(size.size()))
+                size.resize(c + 1, 0);
+            ++size[c];
+        }
+        return size;
+    }
+};
+
+// Weak components by union-find, labelled in order of their smallest node
+template <typename GraphT>
+std::vector<int> weak_components(const GraphT& G) {
+    int n = G.size();
+    std::vector<int> parent(n);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](int v) {
+        while (parent[v] != v)
+            v = parent[v] = parent[parent[v]];
+        return v;
+    };
+    for (int u = 0; u < n; ++u)
+        for (auto [v, w] : G[u]) {
+            int a = find(u), b = find(v);
+            if (a != b)
+                parent[std::max(a, b)] = std::min(a, b);
+        }
+    std::vector<int> label(n);
+    int count = 0;
+    for (int v = 0; v < n; ++v)
+        label[v] = find(v) == v ? count++ : label[find(v)];
+    return label;
+}
+
+// Strong components by Tarjan's algorithm (iterative, road graphs are too deep for recursion).
+// Tarjan completes components sinks first; the labels are reversed to get topological order.
+template <typename GraphT>
+std::vector<int> strong_components(const GraphT& G) {
+    int n = G.size();
+    std::vector<int> index(n, -1), low(n), label(n), stack;
+    std::vector<char> on_stack(n, 0);
+    std::vector<std::pair<int, int>> call;  // node, next out-edge to look at
+    int counter = 0, count = 0;
+    auto open = [&](int v) {
+        index[v] = low[v] = counter++;
+        stack.push_back(v);
+        on_stack[v] = 1;
+        call.push_back({v, 0});
+    };
+    for (int root = 0; root < n; ++root) {
+        if (index[root] >= 0)
+            continue;
+        open(root);
+        while (!call.empty()) {
+            int u = call.back().first;
+            const auto& row = G[u];
+            if (call.back().second < static_cast<int>(row.size())) {
+                auto [v, w] = row.begin()[call.back().second++];
+                if (index[v] < 0)
+                    open(v);
+                else if (on_stack[v])
+                    low[u] = std::min(low[u], index[v]);
+                continue;
+            }
+            call.pop_back();
+            if (!call.empty())
+                low[call.back().first] = std::min(low[call.back().first], low[u]);
+            if (low[u] != index[u])
+                continue;
+            int v;
+            do {
+                v = stack.back();
+                stack.pop_back();
+                on_stack[v] = 0;
+                label[v] = count;
+            } while (v != u);
+            ++count;
+        }
+    }
+    for (int& c : label)
+        c = count - 1 - c;
+    return label;
+}
+
+template <typename GraphT>
+ComponentIndex component_index(const GraphT& G, bool directed) {
+    ComponentIndex index;
+    index.directed = directed;
+    index.weak = weak_components(G);
+    index.strong = directed ? strong_components(G) : index.weak;
+    index.count_sizes();
+    return index;
+}
+
+// A subset of the nodes with its own ids 0 .. size()-1 (kept in their original order)
+struct NodeSubset {
+    std::vector<int> to_new;  // original id -> subset id, -1 if dropped
+    std::vector<int> to_old;  // subset id -> original id
+
+    int size() const { return static_cast<int>(to_old.size()); }
+
+    static NodeSubset all(int n) {
+        NodeSubset subset;
+        subset.to_new.resize(n);
+        std::iota(subset.to_new.begin(), subset.to_new.end(), 0);
+        subset.to_old = subset.to_new;
+        return subset;
+    }
+
+    std::vector<int> original(const std::vector<int>& nodes) const {
+        std::vector<int> out;
+        out.reserve(nodes.size());
+        for (int v : nodes)
+            out.push_back(to_old[v]);
+        return out;
+    }
+};
+
+// The largest strong component (= the largest component of an undirected graph): every pair of its
+// nodes is connected, so no query on it comes back INF
+inline NodeSubset largest_component(const ComponentIndex& index) {
+    int c = index.largest_strong();
+    NodeSubset subset;
+    subset.to_new.assign(index.strong.size(), -1);
+    for (int v = 0; v < static_cast<int>(index.strong.size()); ++v)
+        if (index.strong[v] == c) {
+            subset.to_new[v] = subset.size();
+            subset.to_old.push_back(v);
+        }
+    return subset;
+}
+
+// G restricted to the subset: its nodes, renumbered, and the arcs between them
+template <typename W>
+CSRGraphT<W> induced_graph(const CSRGraphT<W>& G, const NodeSubset& subset) {
+    std::vector<uint32_t> offsets(1, 0);
+    std::vector<CSREdge<W>> adj;
+    for (int u : subset.to_old) {
+        for (auto [v, w] : G[u])
+            if (subset.to_new[v] >= 0)
+                adj.push_back({subset.to_new[v], w});
+        offsets.push_back(static_cast<uint32_t>(adj.size()));
+    }
+    return CSRGraphT<W>(std::move(offsets), std::move(adj));
+}
+
+// Per-node values of the subset's nodes
+template <typename T>
+std::vector<T> select_values(const std::vector<T>& values, const NodeSubset& subset) {
+    if (values.empty())
+        return values;
+    std::vector<T> out;
+    out.reserve(subset.size());
+    for (int v : subset.to_old)
+        out.push_back(values[v]);
+    return out;
+}
+
+#endif  // GRAPH_COMPONENTS_H
@@ -4,9 +4,16 @@
 #include <vector>
 #include <fstream>
 #include <string>
+#include <sstream>
 #include <utility>
 #include <algorithm>
 #include <unordered_set>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+const double INF = std::numeric_limits<double>::infinity();
 
 // Graph structure
 struct Edge {
@@ -15,21 +22,150 @@ struct Edge {
 };
 using Graph = std::vector<std::vector<Edge>>;
 
+// How read_graph treats each "u v w" line: FromHeader uses the optional third
+// header token ("n m directed" / "n m undirected"); files without it are undirected.
+enum class EdgeMode { FromHeader, Undirected, Directed };
+
+struct GraphHeader {
+    int n = 0;
+    int m = 0;
+    bool directed = false;
+};
+
+// Parse the "n m [directed|undirected]" first line of an edge file
+inline GraphHeader parse_graph_header(const std::string& line) {
+    std::istringstream in(line);
+    GraphHeader h;
+    std::string kind;
+    in >> h.n >> h.m >> kind;
+    h.directed = (kind == "directed");
+    return h;
+}
+
+inline GraphHeader read_graph_header(const std::string& filename) {
+    std::ifstream in(filename);
+    std::string line;
+    std::getline(in, line);
+    return parse_graph_header(line);
+}
+
+inline bool is_directed(const GraphHeader& h, EdgeMode mode) {
+    return mode == EdgeMode::FromHeader ? h.directed : mode == EdgeMode::Directed;
+}
+
 // Read graph from file
-inline Graph read_graph(const std::string& filename) {
+inline Graph read_graph(const std::string& filename, EdgeMode mode = EdgeMode::FromHeader) {
     std::ifstream in(filename);
-    int n, m;
-    in >> n >> m;
-    Graph G(n);
-    for (int i = 0, u, v; i < m; ++i) {
+    std::string line;
+    std::getline(in, line);
+    GraphHeader h = parse_graph_header(line);
+    bool directed = is_directed(h, mode);
+    Graph G(h.n);
+    for (int i = 0, u, v; i < h.m; ++i) {
         double w;
         in >> u >> v >> w;
         G[u].push_back({v, w});
-        G[v].push_back({u, w});  // Remove if graph is directed
+        if (!directed)
+            G[v].push_back({u, w});
     }
     return G;
 }
 
+// Reverse graph: every edge u->v becomes v->u, for backward searches on directed graphs
+inline Graph reverse_graph(const Graph& G) {
+    std::vector<size_t> indeg(G.size(), 0);
+    for (const auto& edges : G)
+        for (auto [v, w] : edges)
+            ++indeg[v];
+    Graph R(G.size());
+    for (size_t v = 0; v < G.size(); ++v)
+        R[v].reserve(indeg[v]);
+    for (size_t u = 0; u < G.size(); ++u)
+        for (auto [v, w] : G[u])
+            R[v].push_back({static_cast<int>(u), w});
+    return R;
+}
+
+// Every edge in both directions (any graph type with size() and iterable G[u] of {to, w})
+template <typename GraphT>
+Graph symmetric_graph(const GraphT& G) {
+    int n = G.size();
+    Graph S(n);
+    for (int u = 0; u < n; ++u)
+        for (auto [v, w] : G[u]) {
+            S[u].push_back({v, w});
+            S[v].push_back({u, w});
+        }
+    return S;
+}
+
+// Whether every weight is a non-negative integer (and the largest one): integer-key queues
+// and 32-bit heap keys apply only then. Compute once per graph.
+struct WeightInfo {
+    bool integral = true;
+    uint32_t max_weight = 0;
+};
+
+template <typename GraphT>
+WeightInfo weight_info(const GraphT& G) {
+    WeightInfo info;
+    int n = G.size();
+    for (int u = 0; u < n && info.integral; ++u)
+        for (auto [v, w] : G[u]) {
+            if (!(w >= 0) || w != std::floor(w) || w > UINT32_MAX) {
+                info.integral = false;
+                break;
+            }
+            if (w > info.max_weight)
+                info.max_weight = static_cast<uint32_t>(w);
+        }
+    return info;
+}
+
+// FNV-1a over the node count and every edge (weights as float), so Graph and
+// CSRGraphT of the same file hash alike; used to key on-disk preprocessing caches
+template <typename GraphT>
+uint64_t graph_checksum(const GraphT& G) {
+    uint64_t h = 1469598103934665603ull;
+    auto mix = [&](uint32_t x) {
+        for (int b = 0; b < 4; ++b) {
+            h ^= (x >> (8 * b)) & 0xff;
+            h *= 1099511628211ull;
+        }
+    };
+    int n = G.size();
+    mix(static_cast<uint32_t>(n));
+    for (int u = 0; u < n; ++u) {
+        mix(0xffffffffu); // node separator, so edges cannot shift between nodes unnoticed
+        for (auto [v, w] : G[u]) {
+            float wf = static_cast<float>(w);
+            uint32_t bits;
+            std::memcpy(&bits, &wf, sizeof(bits));
+            mix(static_cast<uint32_t>(v));
+            mix(bits);
+        }
+    }
+    return h;
+}
+
+// Node coordinates, as written by generate_data.py
+struct LatLon {
+    double lat;
+    double lon;
+};
+
+// Read "id lat lon" lines into a vector indexed by node id (missing nodes stay 0,0)
+inline std::vector<LatLon> read_nodes(const std::string& filename, int n) {
+    std::ifstream in(filename);
+    std::vector<LatLon> coords(n, {0.0, 0.0});
+    int id;
+    double lat, lon;
+    while (in >> id >> lat >> lon)
+        if (id >= 0 && id < n)
+            coords[id] = {lat, lon};
+    return coords;
+}
+
 // Reconstruct final path
 inline std::vector<int> reconstruct_path(const std::vector<int>& prev, int target) {
     std::vector<int> path;
@@ -39,6 +175,20 @@ inline std::vector<int> reconstruct_path(const std::vector<int>& prev, int targe
     return path;
 }
 
+// Length of a node path in G: the cheapest arc per hop, INF if some hop is not an arc
+template <typename GraphT>
+double path_length(const GraphT& G, const std::vector<int>& path) {
+    double len = 0;
+    for (size_t i = 1; i < path.size(); ++i) {
+        double hop = INF;
+        for (auto [v, w] : G[path[i - 1]])
+            if (v == path[i])
+                hop = std::min<double>(hop, w);
+        len += hop;
+    }
+    return len;
+}
+
 // Write final path into a file
 inline void write_path(const std::string& filename, const std::vector<int>& path) {
     std::ofstream out(filename);
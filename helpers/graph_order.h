@@ -0,0 +1,197 @@
+#ifndef GRAPH_ORDER_H
+#define GRAPH_ORDER_H
+
+#include "graph_io.h"
+#include "csr_graph.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Node renumbering for cache locality. Search kernels index dist / prev / heap positions by node id,
+// so when the ids of neighbouring nodes are close, a relaxation touches memory the previous one
+// already brought in. The ids from generate_data.py follow OSM dictionary order instead.
+//
+//   hilbert_order   sorts nodes along a Hilbert curve over their coordinates: nodes close on the map
+//                   get close ids (road graphs are near-planar, so map neighbours are graph neighbours)
+//   rcm_order       reverse Cuthill-McKee, a BFS order for graphs without coordinates
+//
+// A NodeOrder holds both directions of the permutation. Run the kernels on permute_graph(G, order),
+// translate inputs with to_new and results with to_old, so files keep the original ids.
+
+struct NodeOrder {
+    std::vector<int> to_new;  // original id -> renumbered id
+    std::vector<int> to_old;  // renumbered id -> original id
+
+    int size() const { return static_cast<int>(to_new.size()); }
+
+    // Built from the renumbered sequence: order[i] is the original id of new node i
+    static NodeOrder from_sequence(std::vector<int> order) {
+        NodeOrder o;
+        o.to_new.assign(order.size(), -1);
+        for (size_t i = 0; i < order.size(); ++i)
+            o.to_new[order[i]] = static_cast<int>(i);
+        o.to_old = std::move(order);
+        return o;
+    }
+
+    static NodeOrder identity(int n) {
+        std::vector<int> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        return from_sequence(std::move(order));
+    }
+
+    // A path or node list of the renumbered graph in original ids
+    std::vector<int> original(const std::vector<int>& nodes) const {
+        std::vector<int> out;
+        out.reserve(nodes.size());
+        for (int v : nodes)
+            out.push_back(to_old[v]);
+        return out;
+    }
+};
+
+// Position of (x, y) on the Hilbert curve filling a 2^16 x 2^16 grid
+inline uint64_t hilbert_index(uint32_t x, uint32_t y) {
+    uint64_t d = 0;
+    for (uint32_t s = 1u << 15; s > 0; s >>= 1) {
+        uint32_t rx = (x & s) > 0, ry = (y & s) > 0;
+        d += uint64_t(s) * s * ((3 * rx) ^ ry);
+        if (ry == 0) {  // rotate the quadrant so the curve stays continuous
+            if (rx == 1) {
+                x = s - 1 - x;
+                y = s - 1 - y;
+            }
+            std::swap(x, y);
+        }
+        x &= s - 1;
+        y &= s - 1;
+    }
+    return d;
+}
+
+inline NodeOrder hilbert_order(const std::vector<LatLon>& coords) {
+    int n = static_cast<int>(coords.size());
+    double min_lat = 90, max_lat = -90, min_lon = 180, max_lon = -180;
+    for (const LatLon& c : coords) {
+        min_lat = std::min(min_lat, c.lat);
+        max_lat = std::max(max_lat, c.lat);
+        min_lon = std::min(min_lon, c.lon);
+        max_lon = std::max(max_lon, c.lon);
+    }
+    auto cell = [](double x, double lo, double hi) {
+        return hi > lo ? static_cast<uint32_t>((x - lo) / (hi - lo) * 65535.0) : 0u;
+    };
+    std::vector<std::pair<uint64_t, int>> keyed(n);
+    for (int v = 0; v < n; ++v)
+        keyed[v] = {hilbert_index(cell(coords[v].lon, min_lon, max_lon), cell(coords[v].lat, min_lat, max_lat)), v};
+    std::sort(keyed.begin(), keyed.end());  // ties by original id
+    std::vector<int> order(n);
+    for (int i = 0; i < n; ++i)
+        order[i] = keyed[i].second;
+    return NodeOrder::from_sequence(std::move(order));
+}
+
+// Reverse Cuthill-McKee: per component, BFS from a minimum-degree node, visiting neighbours by
+// increasing degree, and the whole sequence reversed. Edges are followed in both directions.
+template <typename GraphT>
+NodeOrder rcm_order(const GraphT& G) {
+    int n = G.size();
+    std::vector<std::vector<int>> adj(n);
+    for (int u = 0; u < n; ++u)
+        for (auto [v, w] : G[u])
+            if (v != u) {
+                adj[u].push_back(v);
+                adj[v].push_back(u);
+            }
+    for (auto& a : adj) {
+        std::sort(a.begin(), a.end());
+        a.erase(std::unique(a.begin(), a.end()), a.end());
+    }
+    auto by_degree = [&](int a, int b) {
+        return adj[a].size() != adj[b].size() ? adj[a].size() < adj[b].size() : a < b;
+    };
+
+    std::vector<int> starts(n);
+    std::iota(starts.begin(), starts.end(), 0);
+    std::sort(starts.begin(), starts.end(), by_degree);
+
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<char> seen(n, 0);
+    for (int start : starts) {
+        if (seen[start])
+            continue;
+        seen[start] = 1;
+        order.push_back(start);
+        for (size_t head = order.size() - 1; head < order.size(); ++head) {
+            size_t first = order.size();
+            for (int v : adj[order[head]])
+                if (!seen[v]) {
+                    seen[v] = 1;
+                    order.push_back(v);
+                }
+            std::sort(order.begin() + first, order.end(), by_degree);
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return NodeOrder::from_sequence(std::move(order));
+}
+
+// Hilbert order when every node has coordinates, RCM otherwise
+template <typename GraphT>
+NodeOrder locality_order(const GraphT& G, const std::vector<LatLon>& coords) {
+    if (!coords.empty() && static_cast<int>(coords.size()) == G.size())
+        return hilbert_order(coords);
+    return rcm_order(G);
+}
+
+// G with node ids renumbered by order; each node keeps its edges in their original order
+template <typename W>
+CSRGraphT<W> permute_graph(const CSRGraphT<W>& G, const NodeOrder& order) {
+    int n = G.size();
+    std::vector<uint32_t> offsets(n + 1, 0);
+    for (int i = 0; i < n; ++i)
+        offsets[i + 1] = offsets[i] + G.degree(order.to_old[i]);
+    std::vector<CSREdge<W>> adj;
+    adj.reserve(G.num_edges());
+    for (int i = 0; i < n; ++i)
+        for (auto [v, w] : G[order.to_old[i]])
+            adj.push_back({order.to_new[v], w});
+    return CSRGraphT<W>(std::move(offsets), std::move(adj));
+}
+
+// Per-node values (coordinates, landmark distances, ...) moved to the renumbered ids
+template <typename T>
+std::vector<T> permute_values(const std::vector<T>& values, const NodeOrder& order) {
+    if (values.empty())
+        return values;
+    std::vector<T> out(values.size());
+    for (int i = 0; i < order.size(); ++i)
+        out[i] = values[order.to_old[i]];
+    return out;
+}
+
+// Instrumentation adapter for kernels running on a renumbered graph: node ids reach the wrapped
+// policy (EdgeLog, EdgeStream, ...) in original numbering
+template <typename Instr>
+class Renumbered {
+public:
+    Renumbered(const NodeOrder& order, Instr& inner) : order_(order), inner_(inner) {}
+
+    void settle(int u) { inner_.settle(order_.to_old[u]); }
+    void scan(int u, int v) { inner_.scan(order_.to_old[u], order_.to_old[v]); }
+    void relax(int v) { inner_.relax(order_.to_old[v]); }
+    void push() { inner_.push(); }
+    void pop() { inner_.pop(); }
+    void decrease() { inner_.decrease(); }
+    void stale_pop() { inner_.stale_pop(); }
+
+private:
+    const NodeOrder& order_;
+    Instr& inner_;
+};
+
+#endif  // GRAPH_ORDER_H
@@ -0,0 +1,184 @@
+#ifndef GRAPH_PARALLEL_IO_H
+#define GRAPH_PARALLEL_IO_H
+
+#include "graph_io.h"
+#include "csr_graph.h"
+#include "mapped_file.h"
+#include "parallel.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Multithreaded replacement for read_graph, for edge lists that have not been
+// converted to the binary format yet. The file is memory-mapped and cut into
+// one chunk per thread at line boundaries; each thread parses its chunk with
+// std::from_chars, then the adjacency is built with a parallel counting pass.
+// Per-node edge order is identical to read_graph's push_back order.
+//
+// Unlike read_graph the input is validated: a token that is not a number, a
+// line cut short, a node id outside [0, n) or an edge count other than the
+// header's m throws std::runtime_error naming the file (and the line).
+
+struct ParsedEdge {
+    int u, v;
+    double w;
+};
+
+// Skip spaces/tabs/CRs/newlines; returns false if only whitespace is left in the chunk
+inline bool skip_blanks(const char*& p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n'))
+        ++p;
+    return p < end;
+}
+
+// Skip spaces/tabs/CRs within the current line; returns false at the end of the line or chunk
+inline bool skip_spaces(const char*& p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        ++p;
+    return p < end && *p != '\n';
+}
+
+// Parse one number at p (after skip_blanks/skip_spaces); returns false on a malformed token
+template <typename T>
+inline bool parse_next(const char*& p, const char* end, T& value) {
+    auto [next, ec] = std::from_chars(p, end, value);
+    if (ec != std::errc() || (next < end && *next != ' ' && *next != '\t' && *next != '\r' && *next != '\n'))
+        return false;
+    p = next;
+    return true;
+}
+
+// "<file>:<line>: <what>" for the line containing pos (line 1 is the header)
+inline std::runtime_error edge_list_error(const std::string& filename, const char* begin, const char* pos,
+                                          const std::string& what) {
+    long line = 1 + std::count(begin, pos, '\n');
+    return std::runtime_error(filename + ":" + std::to_string(line) + ": " + what);
+}
+
+template <typename W = double>
+CSRGraphT<W> read_csr_graph_parallel(const std::string& filename, int threads = default_threads(),
+                                     EdgeMode mode = EdgeMode::FromHeader) {
+    MappedFile file(filename);
+    const char* p = file.data();
+    const char* end = p + file.size();
+    if (!p)
+        return CSRGraphT<W>();
+    const char* eol = std::find(p, end, '\n');
+    GraphHeader h = parse_graph_header(std::string(p, eol));
+    int n = h.n, m = h.m;
+    bool directed = is_directed(h, mode);
+    if (n <= 0)
+        return CSRGraphT<W>();
+    p = eol;
+
+    // Chunk boundaries: thread i parses [cut[i], cut[i+1]), each cut just after a '\n'
+    std::vector<const char*> cut(threads + 1, end);
+    cut[0] = p;
+    for (int i = 1; i < threads; ++i) {
+        const char* c = std::max(cut[i - 1], p + (end - p) * i / threads);
+        while (c < end && *c != '\n')
+            ++c;
+        cut[i] = c < end ? c + 1 : end;
+    }
+
+    // Parse chunks and count per-thread degrees
+    // Exceptions cannot leave a worker thread, so each keeps its first error for the caller
+    std::vector<std::vector<ParsedEdge>> parsed(threads);
+    std::vector<std::vector<uint32_t>> count(threads);
+    std::vector<std::exception_ptr> error(threads);
+    const char* begin = file.data();
+    run_threads(threads, [&](int tid) {
+        const char* q = cut[tid];
+        const char* chunk_end = cut[tid + 1];
+        auto& edges = parsed[tid];
+        edges.reserve(static_cast<size_t>(m) / threads + 16);
+        try {
+            ParsedEdge e;
+            while (skip_blanks(q, chunk_end)) {
+                const char* line = q;
+                if (!parse_next(q, chunk_end, e.u) || !skip_spaces(q, chunk_end) ||
+                    !parse_next(q, chunk_end, e.v) || !skip_spaces(q, chunk_end) ||
+                    !parse_next(q, chunk_end, e.w))
+                    throw edge_list_error(filename, begin, q, "expected \"u v w\"");
+                if (e.u < 0 || e.u >= n || e.v < 0 || e.v >= n)
+                    throw edge_list_error(filename, begin, line, "node id out of range [0, " + std::to_string(n) + ")");
+                edges.push_back(e);
+            }
+        } catch (...) {
+            error[tid] = std::current_exception();
+            return;
+        }
+
+        auto& cnt = count[tid];
+        cnt.assign(n, 0);
+        for (const auto& ed : edges) {
+            ++cnt[ed.u];
+            if (!directed)
+                ++cnt[ed.v];
+        }
+    });
+    size_t total = 0;
+    for (int tid = 0; tid < threads; ++tid) {
+        if (error[tid])
+            std::rethrow_exception(error[tid]);
+        total += parsed[tid].size();
+    }
+    if (total != static_cast<size_t>(m))
+        throw std::runtime_error(filename + ": header declares " + std::to_string(m) + " edges, found " +
+                                 std::to_string(total));
+
+    // offsets[u] = total degree prefix; count[tid][u] becomes thread tid's write cursor for u
+    std::vector<uint32_t> offsets(n + 1, 0);
+    for (int u = 0; u < n; ++u) {
+        uint32_t deg = 0;
+        for (int tid = 0; tid < threads; ++tid)
+            deg += count[tid][u];
+        offsets[u + 1] = offsets[u] + deg;
+    }
+    parallel_blocks(n, threads, [&](size_t begin, size_t stop, int) {
+        for (size_t u = begin; u < stop; ++u) {
+            uint32_t pos = offsets[u];
+            for (int tid = 0; tid < threads; ++tid) {
+                uint32_t c = count[tid][u];
+                count[tid][u] = pos;
+                pos += c;
+            }
+        }
+    });
+
+    // Scatter: each thread writes its edges in file order into its own slots
+    std::vector<CSREdge<W>> adj(offsets[n]);
+    run_threads(threads, [&](int tid) {
+        auto& cursor = count[tid];
+        for (const auto& e : parsed[tid]) {
+            adj[cursor[e.u]++] = {e.v, static_cast<W>(e.w)};
+            if (!directed)
+                adj[cursor[e.v]++] = {e.u, static_cast<W>(e.w)};
+        }
+        std::vector<ParsedEdge>().swap(parsed[tid]);
+    });
+
+    return CSRGraphT<W>(std::move(offsets), std::move(adj));
+}
+
+// Parallel read_graph: same Graph as read_graph(filename, mode)
+inline Graph read_graph_parallel(const std::string& filename, int threads = default_threads(),
+                                 EdgeMode mode = EdgeMode::FromHeader) {
+    CSRGraph C = read_csr_graph_parallel<double>(filename, threads, mode);
+    Graph G(C.size());
+    parallel_blocks(G.size(), threads, [&](size_t begin, size_t stop, int) {
+        for (size_t u = begin; u < stop; ++u) {
+            auto edges = C[static_cast<int>(u)];
+            G[u].reserve(edges.size());
+            for (auto [v, w] : edges)
+                G[u].push_back({v, w});
+        }
+    });
+    return G;
+}
+
+#endif  // GRAPH_PARALLEL_IO_H
@@ -0,0 +1,131 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include "timer.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Compile-time instrumentation for the search kernels. A kernel takes a policy object by reference and
+// calls its hooks; since the policy is a template parameter, the hooks inline into the kernel:
+//   settle(u)      u is taken from the queue for good
+//   scan(u, v)     edge u -> v is examined (always in graph direction, also in backward searches)
+//   relax(v)       v got a better tentative distance
+//   push() / pop() / decrease() / stale_pop()
+//                  queue operations; a stale pop is an outdated entry skipped by a lazy queue
+// Time the whole kernel call from outside: nothing in the hooks touches a clock.
+
+struct SearchCounters {
+    uint64_t settled = 0;
+    uint64_t scanned = 0;
+    uint64_t relaxed = 0;
+    uint64_t pushes = 0;
+    uint64_t pops = 0;
+    uint64_t decreases = 0;
+    uint64_t stale_pops = 0;
+
+    SearchCounters& operator+=(const SearchCounters& o) {
+        settled += o.settled;
+        scanned += o.scanned;
+        relaxed += o.relaxed;
+        pushes += o.pushes;
+        pops += o.pops;
+        decreases += o.decreases;
+        stale_pops += o.stale_pops;
+        return *this;
+    }
+};
+
+// Every hook is empty: the calls, and the counters they would feed, compile away
+struct NoInstrumentation {
+    void settle(int) {}
+    void scan(int, int) {}
+    void relax(int) {}
+    void push() {}
+    void pop() {}
+    void decrease() {}
+    void stale_pop() {}
+};
+
+// One increment per event, no clock, no allocation
+struct CountingInstrumentation {
+    SearchCounters counters;
+
+    void settle(int) { ++counters.settled; }
+    void scan(int, int) { ++counters.scanned; }
+    void relax(int) { ++counters.relaxed; }
+    void push() { ++counters.pushes; }
+    void pop() { ++counters.pops; }
+    void decrease() { ++counters.decreases; }
+    void stale_pop() { ++counters.stale_pops; }
+};
+
+// Counters plus every scanned edge, written into a buffer allocated once up front. Edges beyond the
+// capacity are not stored, only counted in dropped(). clear() rewinds it for the next query.
+class EdgeTrace : public CountingInstrumentation {
+public:
+    explicit EdgeTrace(size_t capacity) : buffer_(capacity) {}
+
+    void scan(int u, int v) {
+        CountingInstrumentation::scan(u, v);
+        if (size_ < buffer_.size())
+            buffer_[size_++] = {u, v};
+        else
+            ++dropped_;
+    }
+
+    size_t size() const { return size_; }
+    size_t dropped() const { return dropped_; }
+    const std::pair<int, int>* begin() const { return buffer_.data(); }
+    const std::pair<int, int>* end() const { return buffer_.data() + size_; }
+    std::vector<std::pair<int, int>> edges() const { return {begin(), end()}; }
+
+    void clear() {
+        counters = SearchCounters();
+        size_ = 0;
+        dropped_ = 0;
+    }
+
+private:
+    std::vector<std::pair<int, int>> buffer_;
+    size_t size_ = 0;
+    size_t dropped_ = 0;
+};
+
+// Counters plus every scanned edge appended to a caller's vector: the explored_edges output of the
+// classic kernel signatures
+class EdgeLog : public CountingInstrumentation {
+public:
+    explicit EdgeLog(std::vector<std::pair<int, int>>& out) : out_(out) {}
+
+    void scan(int u, int v) {
+        CountingInstrumentation::scan(u, v);
+        out_.push_back({u, v});
+    }
+
+private:
+    std::vector<std::pair<int, int>>& out_;
+};
+
+// The classic kernel signatures (and the mains) time one uninstrumented run of search(instr), then
+// rerun it untimed with trace (EdgeLog, EdgeStream, ...) to record every scanned edge, so neither the
+// recording nor its allocations end up in the measurement. Returns the timed run's result.
+template <typename Search, typename Trace>
+auto timed_then_traced(Timer& timer, Search&& search, Trace&& trace) {
+    timer.start();
+    auto result = search(NoInstrumentation());
+    timer.pause();
+    search(trace);
+    return result;
+}
+
+// The benchmarks' variant: times the uninstrumented run, then counts the search in an untimed rerun
+template <typename Search>
+auto timed_then_counted(Timer& timer, Search&& search, SearchCounters& counters) {
+    CountingInstrumentation counting;
+    auto result = timed_then_traced(timer, search, counting);
+    counters = counting.counters;
+    return result;
+}
+
+#endif  // INSTRUMENTATION_H
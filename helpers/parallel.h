@@ -0,0 +1,118 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Number of worker threads to use when the caller does not specify one
+inline int default_threads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Run fn(tid) for tid = 0 .. threads-1, each on its own thread, and wait for all
+template <typename F>
+void run_threads(int threads, F fn) {
+    if (threads <= 1) {
+        fn(0);
+        return;
+    }
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    for (int tid = 0; tid < threads; ++tid)
+        pool.emplace_back(fn, tid);
+    for (auto& th : pool)
+        th.join();
+}
+
+// Reusable barrier for a fixed team of threads (C++17 has no std::barrier); waiting threads yield
+class SpinBarrier {
+public:
+    explicit SpinBarrier(int threads) : threads_(threads) {}
+
+    void wait() {
+        unsigned gen = gen_.load(std::memory_order_acquire);
+        if (count_.fetch_add(1, std::memory_order_acq_rel) + 1 == threads_) {
+            count_.store(0, std::memory_order_relaxed);
+            gen_.fetch_add(1, std::memory_order_release);
+            return;
+        }
+        while (gen_.load(std::memory_order_acquire) == gen)
+            std::this_thread::yield();
+    }
+
+private:
+    const int threads_;
+    std::atomic<int> count_{0};
+    std::atomic<unsigned> gen_{0};
+};
+
+// Split [0, n) into `threads` contiguous blocks and call fn(begin, end, tid) on each
+template <typename F>
+void parallel_blocks(size_t n, int threads, F fn) {
+    run_threads(threads, [&](int tid) {
+        size_t begin = n * tid / threads, end = n * (tid + 1) / threads;
+        fn(begin, end, tid);
+    });
+}
+
+// Call fn(i, tid) for every i in [0, n) with work stealing, for items of uneven cost.
+// Each thread starts on its own contiguous block and takes items from its front; a thread whose
+// block runs dry steals the back half of the next non-empty block, so threads stay busy until
+// the last few items without paying a shared counter per item.
+template <typename F>
+void parallel_for_stealing(size_t n, int threads, F fn) {
+    threads = std::max(1, threads);
+    struct alignas(64) Block {
+        std::mutex m;
+        size_t next = 0, end = 0;
+    };
+    std::unique_ptr<Block[]> blocks(new Block[threads]);
+    for (int tid = 0; tid < threads; ++tid) {
+        blocks[tid].next = n * tid / threads;
+        blocks[tid].end = n * (tid + 1) / threads;
+    }
+
+    run_threads(threads, [&](int tid) {
+        Block& own = blocks[tid];
+        while (true) {
+            size_t i = n;
+            {
+                std::lock_guard<std::mutex> lock(own.m);
+                if (own.next < own.end)
+                    i = own.next++;
+            }
+            if (i < n) {
+                fn(i, tid);
+                continue;
+            }
+
+            // Own block is empty: nobody steals from it, so the stolen range can be installed after
+            bool stolen = false;
+            for (int k = 1; k < threads && !stolen; ++k) {
+                Block& victim = blocks[(tid + k) % threads];
+                size_t begin, end;
+                {
+                    std::lock_guard<std::mutex> lock(victim.m);
+                    size_t left = victim.end - victim.next;
+                    if (left == 0)
+                        continue;
+                    end = victim.end;
+                    begin = end - (left + 1) / 2;
+                    victim.end = begin;
+                }
+                std::lock_guard<std::mutex> lock(own.m);
+                own.next = begin;
+                own.end = end;
+                stolen = true;
+            }
+            if (!stolen)
+                return;
+        }
+    });
+}
+
+#endif  // PARALLEL_H
@@ -0,0 +1,105 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Hardware counters of the calling thread (user space only) between start() and stop(), summed over
+// all intervals. Linux only, through perf_event_open; elsewhere, or when the kernel refuses (see
+// /proc/sys/kernel/perf_event_paranoid, virtual machines without a PMU), available() is false and
+// every value stays -1. A counter the CPU lacks is -1 on its own.
+class PerfCounters {
+public:
+    enum Event { Cycles, Instructions, CacheMisses, BranchMisses, EVENT_COUNT };
+
+    static const char* name(int e) {
+        static const char* names[EVENT_COUNT] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+        return names[e];
+    }
+
+    PerfCounters() {
+        totals_.fill(-1);
+#ifdef __linux__
+        const uint64_t configs[EVENT_COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                               PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        for (int e = 0; e < EVENT_COUNT; ++e) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof attr;
+            attr.config = configs[e];
+            attr.disabled = leader_ < 0;  // members follow the group leader
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0));
+            if (fd < 0)
+                continue;
+            if (leader_ < 0)
+                leader_ = fd;
+            fds_.push_back(fd);
+            events_.push_back(e);
+            totals_[e] = 0;
+        }
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds_)
+            close(fd);
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return leader_ >= 0; }
+
+    void start() {
+#ifdef __linux__
+        if (!available())
+            return;
+        ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    void stop() {
+#ifdef __linux__
+        if (!available())
+            return;
+        ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        std::vector<uint64_t> buffer(1 + events_.size());  // {nr, value per event in open order}
+        if (read(leader_, buffer.data(), buffer.size() * sizeof(uint64_t)) <= 0)
+            return;
+        for (size_t i = 0; i < events_.size() && i < buffer[0]; ++i)
+            totals_[events_[i]] += static_cast<int64_t>(buffer[1 + i]);
+#endif
+    }
+
+    // Sum over all start() / stop() intervals so far, -1 where unavailable
+    int64_t value(int e) const { return totals_[e]; }
+
+    void reset() {
+        for (int e : events_)
+            totals_[e] = 0;
+    }
+
+private:
+    int leader_ = -1;
+    std::vector<int> fds_;
+    std::vector<int> events_;
+    std::array<int64_t, EVENT_COUNT> totals_;
+};
+
+#endif  // PERF_COUNTERS_H
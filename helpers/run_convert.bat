@@ -0,0 +1,18 @@
+@echo off
+echo ==============================
+echo Converting Edge Lists to Binary
+echo ==============================
+
+REM Create build folder if not existing
+if not exist ..\build mkdir ..\build
+
+echo [1/1] Compiling convert_graph...
+g++ -std=c++17 -O2 convert_graph.cpp timer.cpp -o ..\build\convert_graph.exe
+
+echo Running convert_graph...
+..\build\convert_graph.exe
+
+echo ==============================
+echo ✅ Binary graphs written to input_edges.
+echo ==============================
+pause
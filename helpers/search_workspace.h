@@ -0,0 +1,153 @@
+#ifndef SEARCH_WORKSPACE_H
+#define SEARCH_WORKSPACE_H
+
+#include "graph_io.h"
+#include "dary_heap.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Scratch state for one search at a time (keep one per thread): distances, predecessors,
+// settled flags and queue storage, allocated once and reused across queries.
+//
+// Instead of refilling dist/prev/vis with n values per query, every node carries a stamp:
+// stamp == gen      reached in the current search (dist/prev valid)
+// stamp == gen + 1  reached and settled
+// stamp <  gen      untouched since an earlier search, reads as dist INF / prev -1
+// begin() just advances gen by 2, so a query costs only the nodes it actually touches.
+class SearchWorkspace {
+public:
+    using QueueEntry = std::pair<double, int>;
+
+    std::vector<QueueEntry> queue;  // lazy binary heap (std::push_heap / pop_heap with std::greater)
+    DaryHeap<double> heap{0};       // indexed heap for decrease-key kernels
+
+    explicit SearchWorkspace(int n = 0) { resize(n); }
+
+    int size() const { return static_cast<int>(stamp_.size()); }
+
+    // Start a new search on a graph of n nodes; O(1) unless n changed (or every 2^31 searches)
+    void begin(int n) {
+        if (n != size())
+            resize(n);
+        if (gen_ >= UINT32_MAX - 2) {
+            std::fill(stamp_.begin(), stamp_.end(), 0u);
+            gen_ = 0;
+        }
+        gen_ += 2;
+        queue.clear();
+        heap.clear();
+        for (auto& entry : typed_heaps_.heaps)
+            entry.second->clear();
+    }
+
+    // Indexed heap with another key type or arity (e.g. uint32_t keys); allocated on first use, then
+    // kept and cleared by begin() like heap. DaryHeap<double> is heap itself.
+    template <typename Key, int D = DARY_HEAP_ARITY>
+    DaryHeap<Key, D>& heap_of() {
+        if constexpr (std::is_same<Key, double>::value && D == DARY_HEAP_ARITY) {
+            return heap;
+        } else {
+            return queue_of<DaryHeap<Key, D>>(size());
+        }
+    }
+
+    // Any other queue type with clear() (e.g. RadixHeap, DialQueue), built as Queue(args...) on first
+    // use and then kept and cleared by begin() like heap; later calls ignore args
+    template <typename Queue, typename... Args>
+    Queue& queue_of(Args&&... args) {
+        std::unique_ptr<AnyHeap>& slot = typed_heaps_.heaps[std::type_index(typeid(Queue))];
+        if (!slot)
+            slot = std::make_unique<TypedHeap<Queue>>(std::forward<Args>(args)...);
+        return static_cast<TypedHeap<Queue>&>(*slot).heap;
+    }
+
+    bool reached(int v) const { return stamp_[v] >= gen_; }
+    bool settled(int v) const { return stamp_[v] == gen_ + 1; }
+    double dist(int v) const { return reached(v) ? dist_[v] : INF; }
+    int prev(int v) const { return reached(v) ? prev_[v] : -1; }
+
+    // Record a (better) tentative distance; a node reached for the first time gets prev -1
+    void set_dist(int v, double d) {
+        if (!reached(v)) {
+            stamp_[v] = gen_;
+            prev_[v] = -1;
+        }
+        dist_[v] = d;
+    }
+    void set_prev(int v, int p) { prev_[v] = p; }
+    void settle(int v) { stamp_[v] = gen_ + 1; }
+
+    // Full-size copies for the classic kernel signatures (O(n))
+    std::vector<double> distances() const {
+        std::vector<double> d(size());
+        for (int v = 0; v < size(); ++v)
+            d[v] = dist(v);
+        return d;
+    }
+    std::vector<int> predecessors() const {
+        std::vector<int> p(size());
+        for (int v = 0; v < size(); ++v)
+            p[v] = prev(v);
+        return p;
+    }
+
+    // s -> t node path of the last search (only touches the path's nodes)
+    std::vector<int> path(int t) const {
+        std::vector<int> nodes;
+        if (!reached(t))
+            return nodes;
+        for (int at = t; at != -1; at = prev(at))
+            nodes.push_back(at);
+        std::reverse(nodes.begin(), nodes.end());
+        return nodes;
+    }
+
+private:
+    struct AnyHeap {
+        virtual ~AnyHeap() = default;
+        virtual void clear() = 0;
+    };
+    template <typename Heap>
+    struct TypedHeap : AnyHeap {
+        template <typename... Args>
+        explicit TypedHeap(Args&&... args) : heap(std::forward<Args>(args)...) {}
+        void clear() override { heap.clear(); }
+        Heap heap;
+    };
+    // Scratch only: a copied workspace starts without them and allocates its own on first use
+    struct TypedHeaps {
+        TypedHeaps() = default;
+        TypedHeaps(const TypedHeaps&) {}
+        TypedHeaps(TypedHeaps&&) = default;
+        TypedHeaps& operator=(const TypedHeaps&) {
+            heaps.clear();
+            return *this;
+        }
+        TypedHeaps& operator=(TypedHeaps&&) = default;
+        std::unordered_map<std::type_index, std::unique_ptr<AnyHeap>> heaps;
+    };
+
+    void resize(int n) {
+        stamp_.assign(n, 0u);
+        dist_.resize(n);
+        prev_.resize(n);
+        heap = DaryHeap<double>(n);
+        typed_heaps_.heaps.clear();  // rebuilt at the new size on their next use
+        gen_ = 2;  // nothing reached until the first begin()
+    }
+
+    std::vector<uint32_t> stamp_;
+    std::vector<double> dist_;
+    std::vector<int> prev_;
+    TypedHeaps typed_heaps_;
+    uint32_t gen_ = 0;
+};
+
+#endif  // SEARCH_WORKSPACE_H
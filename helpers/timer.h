@@ -18,4 +18,9 @@ private:
     std::chrono::time_point<std::chrono::high_resolution_clock> start_time;
 };
 
+// Seconds since start, for one-off measurements (a whole load or batch) that need no Timer
+inline double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
 #endif // TIMER_H
@@ -0,0 +1,245 @@
+#ifndef TRACE_SINK_H
+#define TRACE_SINK_H
+
+#include "instrumentation.h"
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Streaming output for explored edges: records are encoded into fixed-size chunks, and full chunks go
+// to a background thread that writes them to the file. At most MAX_PENDING chunks wait at a time (the
+// search blocks when the disk falls behind), so memory stays bounded whatever the search size.
+//
+//   Text    "u v\n" per edge, the same lines as write_edges (what visualize.py reads)
+//   Binary  magic "DVATRACE", uint32 version, then per edge zigzag varints of u - previous u and v - u;
+//           road graph ids are local, so most edges take 2-4 bytes
+enum class TraceFormat { Text, Binary };
+
+static const char TRACE_MAGIC[8] = {'D', 'V', 'A', 'T', 'R', 'A', 'C', 'E'};
+static const uint32_t TRACE_VERSION = 1;
+
+class TraceWriter {
+public:
+    static constexpr size_t CHUNK = size_t(1) << 18;  // bytes
+    static constexpr size_t MAX_PENDING = 4;          // full chunks queued for the writer thread
+
+    explicit TraceWriter(const std::string& filename, TraceFormat format = TraceFormat::Text)
+        : filename_(filename), format_(format), out_(filename, std::ios::binary) {
+        if (!out_)
+            throw std::runtime_error("cannot write " + filename);
+        chunk_.reserve(CHUNK + 32);
+        if (format_ == TraceFormat::Binary) {
+            chunk_.append(TRACE_MAGIC, sizeof TRACE_MAGIC);
+            chunk_.append(reinterpret_cast<const char*>(&TRACE_VERSION), sizeof TRACE_VERSION);
+        }
+        thread_ = std::thread([this] { run(); });
+    }
+
+    // Flushes what is left; errors are only reported by an explicit close()
+    ~TraceWriter() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    void edge(int u, int v) {
+        if (format_ == TraceFormat::Text) {
+            char buf[32];  // an int takes at most 11 chars
+            char* p = std::to_chars(buf, buf + 12, u).ptr;
+            *p++ = ' ';
+            p = std::to_chars(p, p + 12, v).ptr;
+            *p++ = '\n';
+            chunk_.append(buf, p);
+        } else {
+            put_varint(zigzag(int64_t(u) - last_u_));
+            put_varint(zigzag(int64_t(v) - u));
+            last_u_ = u;
+        }
+        ++edges_;
+        if (chunk_.size() >= CHUNK)
+            hand_off();
+    }
+
+    uint64_t edges() const { return edges_; }
+    uint64_t bytes() const { return bytes_; }  // written so far, all of it after close()
+
+    // Writes the last chunk and waits for the writer thread; throws if any write failed
+    void close() {
+        if (!thread_.joinable())
+            return;
+        hand_off();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+        }
+        ready_.notify_all();
+        thread_.join();
+        out_.close();
+        if (failed_ || !out_)
+            throw std::runtime_error("write to " + filename_ + " failed");
+    }
+
+private:
+    static uint64_t zigzag(int64_t x) { return (static_cast<uint64_t>(x) << 1) ^ static_cast<uint64_t>(x >> 63); }
+
+    void put_varint(uint64_t x) {
+        while (x >= 0x80) {
+            chunk_.push_back(static_cast<char>(x | 0x80));
+            x >>= 7;
+        }
+        chunk_.push_back(static_cast<char>(x));
+    }
+
+    void hand_off() {
+        if (chunk_.empty())
+            return;
+        std::string next;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            drained_.wait(lock, [this] { return pending_.size() < MAX_PENDING; });
+            pending_.push_back(std::move(chunk_));
+            if (!spare_.empty()) {
+                next = std::move(spare_.back());
+                spare_.pop_back();
+            }
+        }
+        ready_.notify_one();
+        next.clear();
+        next.reserve(CHUNK + 32);
+        chunk_ = std::move(next);
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            ready_.wait(lock, [this] { return done_ || !pending_.empty(); });
+            if (pending_.empty())
+                return;  // done and drained
+            std::string chunk = std::move(pending_.front());
+            pending_.pop_front();
+            lock.unlock();
+            drained_.notify_one();
+            if (!out_.write(chunk.data(), chunk.size()))
+                failed_ = true;
+            bytes_ += chunk.size();
+            lock.lock();
+            spare_.push_back(std::move(chunk));  // keeps its capacity for reuse
+        }
+    }
+
+    std::string filename_;
+    TraceFormat format_;
+    std::ofstream out_;
+    std::string chunk_;  // being filled by the search thread
+    int64_t last_u_ = 0;
+    uint64_t edges_ = 0;
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable ready_, drained_;
+    std::deque<std::string> pending_;
+    std::vector<std::string> spare_;
+    bool done_ = false;
+    bool failed_ = false;             // writer thread only, read after join
+    std::atomic<uint64_t> bytes_{0};
+};
+
+// Instrumentation policy: counters plus every scanned edge streamed to a TraceWriter
+class EdgeStream : public CountingInstrumentation {
+public:
+    explicit EdgeStream(TraceWriter& out) : out_(out) {}
+
+    void scan(int u, int v) {
+        CountingInstrumentation::scan(u, v);
+        out_.edge(u, v);
+    }
+
+private:
+    TraceWriter& out_;
+};
+
+// The mains' search: search(instr) runs once uninstrumented under timer, then again untimed with an
+// EdgeStream into filename (see timed_then_traced), so writing the visited edges costs the measured
+// search nothing. Returns the timed run's result.
+template <typename Search>
+double timed_then_streamed(Timer& timer, Search&& search, const std::string& filename) {
+    TraceWriter trace(filename);
+    double result = timed_then_traced(timer, search, EdgeStream(trace));
+    trace.close();
+    return result;
+}
+
+// Reads a trace in either format (binary if it starts with the magic)
+inline std::vector<std::pair<int, int>> read_trace(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("cannot open " + filename);
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::vector<std::pair<int, int>> edges;
+
+    size_t header = sizeof TRACE_MAGIC + sizeof TRACE_VERSION;
+    if (data.size() >= header && std::memcmp(data.data(), TRACE_MAGIC, sizeof TRACE_MAGIC) == 0) {
+        uint32_t version;
+        std::memcpy(&version, data.data() + sizeof TRACE_MAGIC, sizeof version);
+        if (version != TRACE_VERSION)
+            throw std::runtime_error(filename + ": unsupported trace version " + std::to_string(version));
+        size_t pos = header;
+        auto varint = [&]() {
+            uint64_t x = 0;
+            for (int shift = 0;; shift += 7) {
+                if (pos >= data.size() || shift > 63)
+                    throw std::runtime_error(filename + ": truncated trace");
+                uint8_t byte = static_cast<uint8_t>(data[pos++]);
+                x |= uint64_t(byte & 0x7f) << shift;
+                if (!(byte & 0x80))
+                    return static_cast<int64_t>(x >> 1) ^ -static_cast<int64_t>(x & 1);
+            }
+        };
+        int64_t u = 0;
+        while (pos < data.size()) {
+            u += varint();
+            int64_t v = u + varint();
+            edges.push_back({static_cast<int>(u), static_cast<int>(v)});
+        }
+        return edges;
+    }
+
+    const char* p = data.data();
+    const char* end = p + data.size();
+    while (p < end) {
+        while (p < end && (*p == ' ' || *p == '\n' || *p == '\r'))
+            ++p;
+        if (p == end)
+            break;
+        int u, v;
+        auto r = std::from_chars(p, end, u);
+        if (r.ec != std::errc())
+            throw std::runtime_error(filename + ": malformed edge line");
+        p = r.ptr;
+        while (p < end && *p == ' ')
+            ++p;
+        r = std::from_chars(p, end, v);
+        if (r.ec != std::errc())
+            throw std::runtime_error(filename + ": malformed edge line");
+        p = r.ptr;
+        edges.push_back({u, v});
+    }
+    return edges;
+}
+
+#endif  // TRACE_SINK_H
@@ -0,0 +1,324 @@
+//Hub labels: every node keeps a sorted list of (hub, distance) pairs such that each s-t shortest path
+//passes through a hub common to the out-label of s and the in-label of t, so dist(s, t) is a merge-join
+//of two short arrays instead of a graph search. Built by pruned landmark labeling (PLL).
+#ifndef HUB_LABELS_H
+#define HUB_LABELS_H
+
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/csr_graph.h"
+#include "../helpers/search_workspace.h"
+#include "../helpers/instrumentation.h"
+#include "../astar/astar_weighted.h"
+#include "../ch/ch.h"
+#include <vector>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <fstream>
+#include <string>
+#include <limits>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// Label entry: hub is the hub's position in the build order (so sorting by hub sorts by importance)
+struct HubEntry {
+    int hub;
+    float dist;
+};
+
+// All labels packed in one array per direction: label(v) is entries [offsets[v], offsets[v+1]),
+// sorted by hub and closed by a sentinel {INT_MAX, inf}, so the merge-join needs no bounds checks.
+// out(v) holds d(v, hub), in(v) holds d(hub, v); undirected graphs keep only the out-labels.
+struct HubLabels {
+    bool directed = false;
+    std::vector<int> order;               // build position -> node, most important first
+    std::vector<uint64_t> out_offsets;
+    std::vector<HubEntry> out;
+    std::vector<uint64_t> in_offsets;     // empty for undirected graphs
+    std::vector<HubEntry> in;
+
+    int size() const { return static_cast<int>(order.size()); }
+
+    const HubEntry* out_label(int v) const { return out.data() + out_offsets[v]; }
+    const HubEntry* in_label(int v) const { return directed ? in.data() + in_offsets[v] : out_label(v); }
+
+    // Shortest s-t distance (INF if unreachable)
+    double distance(int s, int t) const {
+        const HubEntry* a = out_label(s);
+        const HubEntry* b = in_label(t);
+        double best = INF;
+        while (true) {
+            if (a->hub == b->hub) {
+                if (a->hub == INT_MAX)
+                    break;
+                best = std::min(best, static_cast<double>(a->dist) + b->dist);
+                ++a;
+                ++b;
+            } else if (a->hub < b->hub) {
+                ++a;
+            } else {
+                ++b;
+            }
+        }
+        return best;
+    }
+
+    // Entries per label, sentinels excluded (averaged over both directions if directed)
+    double average_label_size() const {
+        size_t entries = out.size() + in.size();
+        size_t labels = size() * (directed ? 2 : 1);
+        return labels ? double(entries - labels) / labels : 0.0;
+    }
+
+    size_t memory_bytes() const {
+        return order.size() * sizeof(int) + (out_offsets.size() + in_offsets.size()) * sizeof(uint64_t) +
+               (out.size() + in.size()) * sizeof(HubEntry);
+    }
+};
+
+// Builds the labels hub by hub: a Dijkstra from each hub that stops expanding at any node the labels
+// found so far already cover (a shorter-or-equal path through a more important hub), so later hubs
+// only reach the few nodes whose shortest paths avoid every earlier one
+class HubLabelBuilder
+{
+public:
+    template <typename W>
+    HubLabelBuilder(const CSRGraphT<W> &G, bool directed, std::vector<int> order)
+        : n(G.size()), directed(directed), order(std::move(order)), out_l(n), in_l(directed ? n : 0),
+          tmp(n, std::numeric_limits<float>::infinity()), ws(n)
+    {
+        if (static_cast<int>(this->order.size()) != n)
+            throw std::invalid_argument("hub label order must list every node once");
+        std::vector<std::vector<HubEntry>> &in_ref = directed ? in_l : out_l;
+        CSRGraphT<W> R = directed ? reverse_graph(G) : G;
+        for (int i = 0; i < n; ++i)
+        {
+            int h = this->order[i];
+            // Forward from h sets d(h, v) in in(v); backward (on R) sets d(v, h) in out(v)
+            pruned_search(G, i, h, out_l[h], in_ref);
+            if (directed)
+                pruned_search(R, i, h, in_l[h], out_l);
+        }
+    }
+
+    HubLabels build()
+    {
+        HubLabels L;
+        L.directed = directed;
+        L.order = order;
+        pack(out_l, L.out_offsets, L.out);
+        if (directed)
+            pack(in_l, L.in_offsets, L.in);
+        return L;
+    }
+
+private:
+    int n;
+    bool directed;
+    std::vector<int> order;
+    std::vector<std::vector<HubEntry>> out_l, in_l;
+    std::vector<float> tmp; // distances of the hub's own label, indexed by hub, inf elsewhere
+    SearchWorkspace ws;
+
+    // from: the label of h on the side the search starts; to: the labels the search adds hub i to
+    template <typename GraphT>
+    void pruned_search(const GraphT &G, int i, int h, const std::vector<HubEntry> &from,
+                       std::vector<std::vector<HubEntry>> &to)
+    {
+        for (const HubEntry &e : from)
+            tmp[e.hub] = e.dist;
+        std::vector<HubEntry> own = from; // to[h] may be from itself and grow during the search
+
+        ws.begin(n);
+        auto &pq = ws.queue;
+        std::greater<SearchWorkspace::QueueEntry> later;
+        ws.set_dist(h, 0);
+        pq.emplace_back(0, h);
+        while (!pq.empty())
+        {
+            std::pop_heap(pq.begin(), pq.end(), later);
+            auto [d, u] = pq.back();
+            pq.pop_back();
+            if (ws.settled(u))
+                continue;
+            ws.settle(u);
+            if (covered(to[u], d))
+                continue; // pruned: neither labelled nor expanded
+            to[u].push_back({i, static_cast<float>(d)});
+            for (auto [v, w] : G[u])
+            {
+                if (!ws.settled(v) && d + w < ws.dist(v))
+                {
+                    ws.set_dist(v, d + w);
+                    pq.emplace_back(d + w, v);
+                    std::push_heap(pq.begin(), pq.end(), later);
+                }
+            }
+        }
+        for (const HubEntry &e : own)
+            tmp[e.hub] = std::numeric_limits<float>::infinity();
+    }
+
+    bool covered(const std::vector<HubEntry> &label, double d) const
+    {
+        for (const HubEntry &e : label)
+            if (static_cast<double>(tmp[e.hub]) + e.dist <= d)
+                return true;
+        return false;
+    }
+
+    static void pack(std::vector<std::vector<HubEntry>> &labels, std::vector<uint64_t> &offsets,
+                     std::vector<HubEntry> &entries)
+    {
+        size_t total = 0;
+        for (const auto &l : labels)
+            total += l.size() + 1;
+        offsets.assign(1, 0);
+        entries.reserve(total);
+        for (auto &l : labels)
+        {
+            entries.insert(entries.end(), l.begin(), l.end());
+            entries.push_back({INT_MAX, std::numeric_limits<float>::infinity()});
+            offsets.push_back(entries.size());
+            std::vector<HubEntry>().swap(l);
+        }
+    }
+};
+
+template <typename W>
+HubLabels build_hub_labels(const CSRGraphT<W> &G, bool directed, std::vector<int> order)
+{
+    return HubLabelBuilder(G, directed, std::move(order)).build();
+}
+
+inline HubLabels build_hub_labels(const Graph &G, bool directed, std::vector<int> order)
+{
+    return build_hub_labels(CSRGraph(G), directed, std::move(order));
+}
+
+// Importance orders: hubs first. By degree (in + out), or by contraction rank, which puts the nodes
+// that many shortest paths pass through first and gives far smaller labels on road graphs
+template <typename GraphT>
+std::vector<int> degree_order(const GraphT &G)
+{
+    int n = G.size();
+    std::vector<int> degree(n, 0), order(n);
+    for (int u = 0; u < n; ++u)
+        for (auto [v, w] : G[u])
+        {
+            ++degree[u];
+            ++degree[v];
+        }
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return degree[a] > degree[b]; });
+    return order;
+}
+
+inline std::vector<int> ch_order(const ContractionHierarchy &H)
+{
+    std::vector<int> order(H.size());
+    for (int v = 0; v < H.size(); ++v)
+        order[H.size() - 1 - H.rank[v]] = v;
+    return order;
+}
+
+// Node path s -> t by A* with the labels as heuristic: h(v) = dist(v, t) is exact, so only nodes on
+// shortest paths are expanded. Returns dist(s, t), path via ws.path(t); no search if t is unreachable.
+template <typename GraphT, typename Instr = NoInstrumentation>
+double hub_label_search(const GraphT &G, const HubLabels &L, int s, int t, SearchWorkspace &ws,
+                        Instr &&instr = Instr())
+{
+    ws.begin(G.size());
+    if (L.distance(s, t) == INF)
+        return INF;
+    auto h = [&L, t](int v) { return L.distance(v, t); };
+    return astar_weighted(G, s, t, h, 1.0, ws, std::forward<Instr>(instr));
+}
+
+// Label file (little-endian): magic, version, graph checksum, n, directed flag, entry counts,
+// then order[n], out_offsets[n+1], out and, if directed, in_offsets[n+1], in
+const char HUB_LABEL_MAGIC[8] = {'D', 'V', 'A', 'H', 'U', 'B', 'L', 'B'};
+const uint32_t HUB_LABEL_VERSION = 1;
+
+// "../input_edges/graph_x_edges.txt" -> "../input_edges/graph_x_edges.hl"
+inline std::string hl_path(const std::string &input)
+{
+    std::string bin = graph_bin_path(input);
+    return bin.substr(0, bin.size() - 4) + ".hl";
+}
+
+inline void save_hub_labels(const std::string &filename, uint64_t checksum, const HubLabels &L)
+{
+    std::ofstream out(filename, std::ios::binary);
+    uint32_t n = L.size(), directed = L.directed;
+    uint64_t counts[2] = {L.out.size(), L.in.size()};
+    out.write(HUB_LABEL_MAGIC, sizeof(HUB_LABEL_MAGIC));
+    out.write(reinterpret_cast<const char *>(&HUB_LABEL_VERSION), sizeof(HUB_LABEL_VERSION));
+    out.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+    out.write(reinterpret_cast<const char *>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char *>(&directed), sizeof(directed));
+    out.write(reinterpret_cast<const char *>(counts), sizeof(counts));
+    out.write(reinterpret_cast<const char *>(L.order.data()), n * sizeof(int));
+    out.write(reinterpret_cast<const char *>(L.out_offsets.data()), L.out_offsets.size() * sizeof(uint64_t));
+    out.write(reinterpret_cast<const char *>(L.out.data()), L.out.size() * sizeof(HubEntry));
+    out.write(reinterpret_cast<const char *>(L.in_offsets.data()), L.in_offsets.size() * sizeof(uint64_t));
+    out.write(reinterpret_cast<const char *>(L.in.data()), L.in.size() * sizeof(HubEntry));
+    if (!out)
+        throw std::runtime_error("cannot write " + filename);
+}
+
+// Fill L from the file if it exists and was built for this graph and directedness
+inline bool load_hub_labels(const std::string &filename, uint64_t checksum, int n, bool directed, HubLabels &L)
+{
+    std::ifstream in(filename, std::ios::binary);
+    char magic[8];
+    uint32_t version = 0, file_n = 0, file_directed = 0;
+    uint64_t file_checksum = 0, counts[2] = {0, 0};
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    in.read(reinterpret_cast<char *>(&file_checksum), sizeof(file_checksum));
+    in.read(reinterpret_cast<char *>(&file_n), sizeof(file_n));
+    in.read(reinterpret_cast<char *>(&file_directed), sizeof(file_directed));
+    in.read(reinterpret_cast<char *>(counts), sizeof(counts));
+    if (!in || std::memcmp(magic, HUB_LABEL_MAGIC, sizeof(magic)) != 0 || version != HUB_LABEL_VERSION ||
+        file_checksum != checksum || (int)file_n != n || (file_directed != 0) != directed)
+        return false;
+
+    L.directed = directed;
+    L.order.resize(n);
+    L.out_offsets.resize(n + 1);
+    L.out.resize(counts[0]);
+    L.in_offsets.resize(directed ? n + 1 : 0);
+    L.in.resize(counts[1]);
+    in.read(reinterpret_cast<char *>(L.order.data()), n * sizeof(int));
+    in.read(reinterpret_cast<char *>(L.out_offsets.data()), L.out_offsets.size() * sizeof(uint64_t));
+    in.read(reinterpret_cast<char *>(L.out.data()), L.out.size() * sizeof(HubEntry));
+    in.read(reinterpret_cast<char *>(L.in_offsets.data()), L.in_offsets.size() * sizeof(uint64_t));
+    in.read(reinterpret_cast<char *>(L.in.data()), L.in.size() * sizeof(HubEntry));
+    return static_cast<bool>(in);
+}
+
+// Labels for G from their file next to input, otherwise built in contraction order (the hierarchy
+// itself comes from open_ch, so it is cached too) and saved there
+template <typename GraphT>
+HubLabels open_hub_labels(const GraphT &G, const std::string &input, bool directed, bool *from_cache = nullptr)
+{
+    HubLabels L;
+    std::string filename = hl_path(input);
+    uint64_t checksum = graph_checksum(G);
+    bool hit = load_hub_labels(filename, checksum, G.size(), directed, L);
+    if (!hit)
+    {
+        L = build_hub_labels(G, directed, ch_order(open_ch(G, input)));
+        save_hub_labels(filename, checksum, L);
+    }
+    if (from_cache)
+        *from_cache = hit;
+    return L;
+}
+
+#endif  // HUB_LABELS_H
@@ -0,0 +1,22 @@
+@echo off
+echo ==============================
+echo Compiling Hub Labels
+echo ==============================
+
+REM Create build folder if not existing
+if not exist ..\build mkdir ..\build
+
+echo [1/1] Compiling hub_labels...
+g++ -std=c++17 -O2 -I..\helpers hub_labels.cpp ..\helpers\timer.cpp -o ..\build\hub_labels.exe
+
+echo ==============================
+echo Running Hub Labels
+echo ==============================
+
+echo Running hub_labels...
+..\build\hub_labels.exe
+
+echo ==============================
+echo ✅ Hub label queries completed.
+echo ==============================
+pause
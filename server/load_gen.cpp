@@ -0,0 +1,142 @@
+// Load generator for routing_server: C connections, each keeping up to D requests in flight, send random
+// queries and time every answer from send to receipt; then the server's own stats are printed.
+//
+//   load_gen [--socket PATH] [--algorithm dijk_lazy] [--connections C] [--depth D] [--queries N]
+//
+// Node ids are drawn below the "nodes" count the server reports, with the same seeds on every run.
+
+#include "../helpers/graph_io.h"
+#include "../batch/batch_engine.h"
+#include "protocol.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+struct ConnectionResult {
+    vector<double> latency;  // seconds, per answered query
+    size_t errors = 0, unreachable = 0;
+};
+
+// Request / response round trip for the non-query ops
+string server_stats(const string& socket_path)
+{
+    int fd = connect_unix(socket_path);
+    RouteRequest req;
+    req.op = Op::Stats;
+    string payload;
+    RouteResponse resp;
+    bool ok = write_frame(fd, encode(req)) && read_frame(fd, payload) && decode(payload, resp);
+    close_fd(fd);
+    if (!ok)
+        throw runtime_error("no stats from the server");
+    return resp.text;
+}
+
+ConnectionResult run_connection(const string& socket_path, int algorithm, const vector<Query>& queries, int depth)
+{
+    ConnectionResult r;
+    int fd = connect_unix(socket_path);
+    vector<chrono::steady_clock::time_point> sent(queries.size());
+    size_t next = 0, received = 0;
+    string payload;
+    RouteResponse resp;
+    while (received < queries.size()) {
+        // Top the pipeline up to depth requests, in one write
+        string frames;
+        for (; next < queries.size() && next - received < static_cast<size_t>(depth); ++next) {
+            RouteRequest req;
+            req.id = static_cast<uint32_t>(next);
+            req.algorithm = static_cast<uint8_t>(algorithm);
+            req.s = queries[next].s;
+            req.t = queries[next].t;
+            append_frame(frames, encode(req));
+            sent[next] = chrono::steady_clock::now();
+        }
+        if (!frames.empty() && !write_all(fd, frames.data(), frames.size()))
+            throw runtime_error("connection lost");
+        if (!read_frame(fd, payload) || !decode(payload, resp) || resp.id >= queries.size())
+            throw runtime_error("connection lost");
+        ++received;
+        r.latency.push_back(chrono::duration<double>(chrono::steady_clock::now() - sent[resp.id]).count());
+        r.errors += resp.status != Status::Ok;
+        r.unreachable += resp.status == Status::Ok && resp.dist == INF;
+    }
+    close_fd(fd);
+    return r;
+}
+
+int main(int argc, char** argv)
+{
+    string socket_path = DEFAULT_SOCKET, algorithm = "dijk_lazy";
+    int connections = 4, depth = 8, total = 2000;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--socket" && has_value)
+            socket_path = argv[++i];
+        else if (arg == "--algorithm" && has_value)
+            algorithm = argv[++i];
+        else if (arg == "--connections" && has_value)
+            connections = max(1, stoi(argv[++i]));
+        else if (arg == "--depth" && has_value)
+            depth = max(1, stoi(argv[++i]));
+        else if (arg == "--queries" && has_value)
+            total = max(1, stoi(argv[++i]));
+        else {
+            cerr << "usage: load_gen [--socket PATH] [--algorithm name] [--connections C] [--depth D] [--queries N]\n";
+            return 2;
+        }
+    }
+    int id = algorithm_id(algorithm);
+    if (id < 0) {
+        cerr << "unknown algorithm " << algorithm << "\n";
+        return 2;
+    }
+
+    try {
+        ignore_sigpipe();
+        string stats = server_stats(socket_path);
+        istringstream lines(stats);
+        string key;
+        int n = 0;
+        while (lines >> key)
+            if (key == "nodes")
+                lines >> n;
+            else
+                lines.ignore(numeric_limits<streamsize>::max(), '\n');
+        if (n <= 0)
+            throw runtime_error("server did not report its node count");
+
+        vector<ConnectionResult> results(connections);
+        vector<thread> clients;
+        auto start = chrono::steady_clock::now();
+        for (int c = 0; c < connections; ++c) {
+            int count = total / connections + (c < total % connections);
+            clients.emplace_back([&, c, count] {
+                results[c] = run_connection(socket_path, id, random_queries(n, count, 42 + c), depth);
+            });
+        }
+        for (thread& th : clients)
+            th.join();
+        double wall = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        vector<double> latency;
+        size_t errors = 0, unreachable = 0;
+        for (const ConnectionResult& r : results) {
+            latency.insert(latency.end(), r.latency.begin(), r.latency.end());
+            errors += r.errors;
+            unreachable += r.unreachable;
+        }
+        sort(latency.begin(), latency.end());
+        cout << algorithm << ": " << latency.size() << " queries over " << connections << " connections, "
+             << depth << " in flight each\n";
+        cout << fixed << setprecision(1) << "  " << latency.size() / wall << " queries/s, latency p50 "
+             << percentile(latency, 0.50) * 1e6 << " us, p90 " << percentile(latency, 0.90) * 1e6 << " us, p99 "
+             << percentile(latency, 0.99) * 1e6 << " us, max " << latency.back() * 1e6 << " us\n";
+        cout << "  " << unreachable << " unreachable, " << errors << " errors\n";
+        cout << "Server stats:\n" << server_stats(socket_path);
+    } catch (const exception& e) {
+        cerr << e.what() << "\n";
+        return 1;
+    }
+}
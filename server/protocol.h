@@ -0,0 +1,299 @@
+//Wire protocol of the routing daemon: length-prefixed binary frames over a Unix domain socket or a
+//stdin/stdout pipe, plus the small amount of fd and socket plumbing both ends share.
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Every frame is a uint32 payload length followed by the payload; all fields little-endian, as in the
+// binary graph files. Requests are answered in completion order, not arrival order: match them by id.
+//
+//   request   uint8 op, uint32 id, then for Query: uint8 algorithm, uint8 flags, int32 s, int32 t
+//   response  uint8 op, uint8 status, uint32 id, then
+//               Query:  double dist (inf if unreachable), float server_us, uint32 count, int32 path[count]
+//               Stats:  uint32 length, "key value" text lines
+//
+// Shutdown asks the server to answer what it has queued and exit (its response carries no body).
+enum class Op : uint8_t { Query = 1, Stats = 2, Shutdown = 3 };
+enum class Status : uint8_t { Ok = 0, BadRequest = 1, Unsupported = 2 };
+
+const uint8_t WANT_PATH = 1;                  // request flag: include the node path in the response
+const uint32_t MAX_FRAME_BYTES = 64u << 20;   // larger lengths are treated as a broken stream
+const char DEFAULT_SOCKET[] = "/tmp/dijkstra-vs-astar.sock";
+
+// Algorithm ids on the wire are positions in this list
+const std::vector<std::string> ALGORITHMS = {"dijk_lazy", "dijk_decKey", "dijk_bidir", "astar_alt",
+                                             "astar_weighted", "ch", "hl"};
+
+inline int algorithm_id(const std::string& name) {
+    for (size_t i = 0; i < ALGORITHMS.size(); ++i)
+        if (ALGORITHMS[i] == name)
+            return static_cast<int>(i);
+    return -1;
+}
+
+struct RouteRequest {
+    Op op = Op::Query;
+    uint32_t id = 0;
+    uint8_t algorithm = 0;
+    uint8_t flags = 0;
+    int32_t s = 0, t = 0;
+};
+
+struct RouteResponse {
+    Op op = Op::Query;
+    Status status = Status::Ok;
+    uint32_t id = 0;
+    double dist = std::numeric_limits<double>::infinity();
+    float server_us = 0;
+    std::vector<int32_t> path;
+    std::string text;  // Stats
+};
+
+// Appends fixed-size fields to a payload
+class PayloadWriter {
+public:
+    template <typename T>
+    void put(T value) { bytes.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
+    void put_bytes(const void* data, size_t size) { bytes.append(static_cast<const char*>(data), size); }
+    std::string bytes;
+};
+
+// Reads them back; every get fails (and keeps failing) once the payload is exhausted
+class PayloadReader {
+public:
+    explicit PayloadReader(const std::string& bytes) : bytes_(bytes) {}
+    template <typename T>
+    bool get(T& value) { return get_bytes(&value, sizeof(T)); }
+    bool get_bytes(void* data, size_t size) {
+        if (size > bytes_.size() - pos_)
+            return false;
+        std::memcpy(data, bytes_.data() + pos_, size);
+        pos_ += size;
+        return true;
+    }
+    bool done() const { return pos_ == bytes_.size(); }
+
+private:
+    const std::string& bytes_;
+    size_t pos_ = 0;
+};
+
+inline std::string encode(const RouteRequest& r) {
+    PayloadWriter out;
+    out.put(r.op);
+    out.put(r.id);
+    if (r.op == Op::Query) {
+        out.put(r.algorithm);
+        out.put(r.flags);
+        out.put(r.s);
+        out.put(r.t);
+    }
+    return out.bytes;
+}
+
+// false on a malformed payload; fields read before the error (usually op and id) keep their values
+inline bool decode(const std::string& payload, RouteRequest& r) {
+    PayloadReader in(payload);
+    if (!in.get(r.op) || !in.get(r.id))
+        return false;
+    if (r.op == Op::Query)
+        return in.get(r.algorithm) && in.get(r.flags) && in.get(r.s) && in.get(r.t) && in.done();
+    return (r.op == Op::Stats || r.op == Op::Shutdown) && in.done();
+}
+
+inline std::string encode(const RouteResponse& r) {
+    PayloadWriter out;
+    out.put(r.op);
+    out.put(r.status);
+    out.put(r.id);
+    if (r.op == Op::Query) {
+        out.put(r.dist);
+        out.put(r.server_us);
+        out.put(static_cast<uint32_t>(r.path.size()));
+        out.put_bytes(r.path.data(), r.path.size() * sizeof(int32_t));
+    } else if (r.op == Op::Stats) {
+        out.put(static_cast<uint32_t>(r.text.size()));
+        out.put_bytes(r.text.data(), r.text.size());
+    }
+    return out.bytes;
+}
+
+inline bool decode(const std::string& payload, RouteResponse& r) {
+    PayloadReader in(payload);
+    uint32_t count = 0;
+    if (!in.get(r.op) || !in.get(r.status) || !in.get(r.id))
+        return false;
+    if (r.op == Op::Query) {
+        if (!in.get(r.dist) || !in.get(r.server_us) || !in.get(count) || count > MAX_FRAME_BYTES / sizeof(int32_t))
+            return false;
+        r.path.resize(count);
+        return in.get_bytes(r.path.data(), count * sizeof(int32_t)) && in.done();
+    }
+    if (r.op == Op::Stats) {
+        if (!in.get(count) || count > MAX_FRAME_BYTES)
+            return false;
+        r.text.resize(count);
+        return in.get_bytes(&r.text[0], count) && in.done();
+    }
+    return in.done();
+}
+
+/* ---------- frames over file descriptors ---------- */
+
+// Reads exactly size bytes; false on end of stream or error
+inline bool read_exact(int fd, char* data, size_t size) {
+    while (size > 0) {
+#ifdef _WIN32
+        int got = _read(fd, data, static_cast<unsigned>(size));
+#else
+        ssize_t got = ::read(fd, data, size);
+#endif
+        if (got < 0 && errno == EINTR)
+            continue;
+        if (got <= 0)
+            return false;
+        data += got;
+        size -= static_cast<size_t>(got);
+    }
+    return true;
+}
+
+inline bool write_all(int fd, const char* data, size_t size) {
+    while (size > 0) {
+#ifdef _WIN32
+        int put = _write(fd, data, static_cast<unsigned>(size));
+#else
+        ssize_t put = ::write(fd, data, size);
+#endif
+        if (put < 0 && errno == EINTR)
+            continue;
+        if (put <= 0)
+            return false;
+        data += put;
+        size -= static_cast<size_t>(put);
+    }
+    return true;
+}
+
+// Next payload from fd; false at the end of the stream or on a malformed length
+inline bool read_frame(int fd, std::string& payload) {
+    uint32_t size = 0;
+    if (!read_exact(fd, reinterpret_cast<char*>(&size), sizeof(size)) || size > MAX_FRAME_BYTES)
+        return false;
+    payload.resize(size);
+    return size == 0 || read_exact(fd, &payload[0], size);
+}
+
+// Length prefix + payload appended to out, so several frames can leave in one write
+inline void append_frame(std::string& out, const std::string& payload) {
+    uint32_t size = static_cast<uint32_t>(payload.size());
+    out.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    out += payload;
+}
+
+inline bool write_frame(int fd, const std::string& payload) {
+    std::string frame;
+    append_frame(frame, payload);
+    return write_all(fd, frame.data(), frame.size());
+}
+
+/* ---------- Unix domain sockets (POSIX only; elsewhere use the stdin pipe) ---------- */
+
+// Binary-safe stdin/stdout (Windows translates line endings in text mode)
+inline void binary_stdio() {
+#ifdef _WIN32
+    _setmode(0, _O_BINARY);
+    _setmode(1, _O_BINARY);
+#endif
+}
+
+// A peer that disconnects must fail the write, not kill the process
+inline void ignore_sigpipe() {
+#ifndef _WIN32
+    signal(SIGPIPE, SIG_IGN);
+#endif
+}
+
+#ifdef _WIN32
+inline int listen_unix(const std::string&) {
+    throw std::runtime_error("Unix domain sockets are not supported in this build; use --stdin");
+}
+inline int connect_unix(const std::string&) {
+    throw std::runtime_error("Unix domain sockets are not supported in this build; pipe through --encode / --decode");
+}
+inline int accept_connection(int) { return -1; }
+inline void shutdown_fd(int) {}
+inline void shutdown_read(int) {}
+inline void close_fd(int fd) { _close(fd); }
+#else
+inline sockaddr_un unix_address(const std::string& path) {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path))
+        throw std::runtime_error("socket path too long: " + path);
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return addr;
+}
+
+// Listening socket at path (a stale socket file from an earlier run is replaced)
+inline int listen_unix(const std::string& path) {
+    sockaddr_un addr = unix_address(path);
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        throw std::runtime_error("cannot create socket: " + std::string(std::strerror(errno)));
+    ::unlink(path.c_str());
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || ::listen(fd, 64) < 0) {
+        std::string error = std::strerror(errno);
+        ::close(fd);
+        throw std::runtime_error("cannot listen on " + path + ": " + error);
+    }
+    return fd;
+}
+
+inline int connect_unix(const std::string& path) {
+    sockaddr_un addr = unix_address(path);
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        std::string error = std::strerror(errno);
+        if (fd >= 0)
+            ::close(fd);
+        throw std::runtime_error("cannot connect to " + path + ": " + error + " (is routing_server running?)");
+    }
+    return fd;
+}
+
+// Next client of a listening socket, -1 once the socket is shut down
+inline int accept_connection(int listen_fd) {
+    while (true) {
+        int fd = ::accept(listen_fd, nullptr, nullptr);
+        if (fd >= 0 || errno != EINTR)
+            return fd;
+    }
+}
+
+// Wakes up threads blocked reading (or accepting) on fd
+inline void shutdown_fd(int fd) { ::shutdown(fd, SHUT_RDWR); }
+// Same for readers only: fd stays writable, so responses already queued for it still get out
+inline void shutdown_read(int fd) { ::shutdown(fd, SHUT_RD); }
+inline void close_fd(int fd) { ::close(fd); }
+#endif
+
+#endif  // PROTOCOL_H
@@ -0,0 +1,197 @@
+// Client for routing_server (protocol.h).
+//
+//   route_client [--socket PATH] <algorithm> <s> <t> [--path]    one query
+//   route_client [--socket PATH] <algorithm> --queries <file>    every pair of a query file, pipelined
+//   route_client [--socket PATH] --stats | --shutdown
+//   route_client --encode <algorithm> <file>                     request frames for a query file to stdout
+//   route_client --decode                                        response frames from stdin as text
+//
+// --encode / --decode drive a server started with --stdin from a shell pipeline (no socket needed):
+//   route_client --encode ch queries.txt | routing_server --stdin | route_client --decode
+
+#include "../helpers/graph_io.h"
+#include "../batch/batch_engine.h"
+#include "protocol.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+void usage()
+{
+    cerr << "usage: route_client [--socket PATH] <algorithm> <s> <t> [--path]\n"
+            "       route_client [--socket PATH] <algorithm> --queries <file>\n"
+            "       route_client [--socket PATH] --stats | --shutdown\n"
+            "       route_client --encode <algorithm> <file>\n"
+            "       route_client --decode\n"
+            "algorithms:";
+    for (const string& a : ALGORITHMS)
+        cerr << " " << a;
+    cerr << "\n";
+}
+
+// "s t" pairs of a query file (ids are checked by the server)
+vector<Query> query_file(const string& filename)
+{
+    return read_queries(filename, numeric_limits<int>::max());
+}
+
+RouteRequest query_request(uint32_t id, int algorithm, int s, int t, bool want_path)
+{
+    RouteRequest req;
+    req.id = id;
+    req.algorithm = static_cast<uint8_t>(algorithm);
+    req.flags = want_path ? WANT_PATH : 0;
+    req.s = s;
+    req.t = t;
+    return req;
+}
+
+string describe(Status status)
+{
+    switch (status) {
+    case Status::Ok: return "ok";
+    case Status::BadRequest: return "bad request";
+    case Status::Unsupported: return "algorithm not served";
+    }
+    return "unknown status";
+}
+
+// "id dist" per query response ("inf" if unreachable, or the error), stats as they are
+void print_response(const RouteResponse& resp)
+{
+    if (resp.op == Op::Stats) {
+        cout << resp.text;
+        return;
+    }
+    if (resp.op == Op::Shutdown) {
+        cout << "server shutting down\n";
+        return;
+    }
+    cout << resp.id << " ";
+    if (resp.status != Status::Ok)
+        cout << describe(resp.status);
+    else if (resp.dist == INF)
+        cout << "inf";
+    else
+        cout << resp.dist;
+    cout << "\n";
+}
+
+int main(int argc, char** argv)
+{
+    vector<string> args;
+    string socket_path = DEFAULT_SOCKET;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc)
+            socket_path = argv[++i];
+        else
+            args.push_back(arg);
+    }
+    if (args.empty()) {
+        usage();
+        return 2;
+    }
+
+    try {
+        if (args[0] == "--decode") {
+            binary_stdio();
+            string payload;
+            RouteResponse resp;
+            while (read_frame(0, payload))
+                if (decode(payload, resp))
+                    print_response(resp);
+            return 0;
+        }
+        if (args[0] == "--encode") {
+            int algorithm = args.size() == 3 ? algorithm_id(args[1]) : -1;
+            if (algorithm < 0) {
+                usage();
+                return 2;
+            }
+            binary_stdio();
+            string frames;
+            uint32_t id = 0;
+            for (const Query& q : query_file(args[2]))
+                append_frame(frames, encode(query_request(id++, algorithm, q.s, q.t, false)));
+            return write_all(1, frames.data(), frames.size()) ? 0 : 1;
+        }
+
+        ignore_sigpipe();
+        int fd = connect_unix(socket_path);
+        string payload;
+        RouteResponse resp;
+        if (args[0] == "--stats" || args[0] == "--shutdown") {
+            RouteRequest req;
+            req.op = args[0] == "--stats" ? Op::Stats : Op::Shutdown;
+            if (!write_frame(fd, encode(req)) || !read_frame(fd, payload) || !decode(payload, resp))
+                throw runtime_error("no response from the server");
+            print_response(resp);
+            close_fd(fd);
+            return 0;
+        }
+
+        int algorithm = algorithm_id(args[0]);
+        if (algorithm < 0 || args.size() < 3) {
+            usage();
+            return 2;
+        }
+
+        // Query file: everything is sent at once and the answers are printed in file order
+        if (args[1] == "--queries") {
+            vector<Query> queries = query_file(args[2]);
+            string frames;
+            for (size_t i = 0; i < queries.size(); ++i)
+                append_frame(frames, encode(query_request(static_cast<uint32_t>(i), algorithm, queries[i].s,
+                                                          queries[i].t, false)));
+            auto start = chrono::steady_clock::now();
+            thread sender([&] { write_all(fd, frames.data(), frames.size()); });
+            vector<RouteResponse> answers(queries.size());
+            size_t got = 0;
+            for (; got < queries.size(); ++got) {
+                if (!read_frame(fd, payload) || !decode(payload, resp) || resp.id >= queries.size())
+                    break;
+                answers[resp.id] = resp;
+            }
+            double wall = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            sender.join();  // before any throw: a joinable thread would terminate the client
+            if (got < queries.size())
+                throw runtime_error("connection lost after " + to_string(got) + " answers");
+            for (size_t i = 0; i < queries.size(); ++i) {
+                cout << queries[i].s << " " << queries[i].t << " ";
+                if (answers[i].status != Status::Ok)
+                    cout << describe(answers[i].status);
+                else if (answers[i].dist == INF)
+                    cout << "inf";
+                else
+                    cout << answers[i].dist;
+                cout << "\n";
+            }
+            cerr << queries.size() << " queries in " << wall << " seconds ("
+                 << (wall > 0 ? queries.size() / wall : 0) << " queries/s)\n";
+            close_fd(fd);
+            return 0;
+        }
+
+        bool want_path = args.size() >= 4 && args[3] == "--path";
+        auto start = chrono::steady_clock::now();
+        if (!write_frame(fd, encode(query_request(0, algorithm, stoi(args[1]), stoi(args[2]), want_path))) ||
+            !read_frame(fd, payload) || !decode(payload, resp))
+            throw runtime_error("no response from the server");
+        double round_trip = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        close_fd(fd);
+        if (resp.status != Status::Ok)
+            throw runtime_error(describe(resp.status));
+        cout << "Shortest distance: " << resp.dist << "\n";
+        cout << "Server time: " << resp.server_us << " us, round trip: " << round_trip << " us\n";
+        if (want_path) {
+            cout << "Path (" << resp.path.size() << " nodes):";
+            for (int v : resp.path)
+                cout << " " << v;
+            cout << "\n";
+        }
+    } catch (const exception& e) {
+        cerr << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,540 @@
+// Routing daemon: loads one graph, and the preprocessing of the algorithms it serves, once, then answers
+// requests in the binary protocol of protocol.h until it is told to shut down (or stdin ends).
+//
+//   routing_server [--dataset large] [--socket PATH | --stdin] [--threads N] [--batch B]
+//                  [--algorithms dijk_lazy,astar_alt,... | all]
+//
+// Requests go to a pool of workers; each worker takes up to B queued requests at a time and writes
+// their responses to each connection in one go, so concurrent clients share the system calls.
+// Unreachable pairs (graph_components.h) are answered INF without a search. Landmarks, the hierarchy
+// and the hub labels come from their cache files next to the edge file (built on first use).
+// Log lines go to stderr: with --stdin, stdout carries the responses.
+
+#include "../helpers/graph_io.h"
+#include "../helpers/graph_bin.h"
+#include "../helpers/geo_heuristic.h"
+#include "../helpers/search_workspace.h"
+#include "../dijkstra/dijk_lazy.h"
+#include "../dijkstra/dijk_decKey.h"
+#include "../dijkstra/dijk_bidir.h"
+#include "../astar/astar_alt.h"
+#include "../astar/astar_weighted.h"
+#include "../astar/landmark_cache.h"
+#include "../ch/ch.h"
+#include "../hl/hub_labels.h"
+#include "protocol.h"
+#include <bits/stdc++.h>
+
+using namespace std;
+
+const int LANDMARKS = 16;  // same setup as the astar_alt main
+
+// Per-worker scratch state
+struct Worker {
+    SearchWorkspace ws, bwd;
+    unique_ptr<CHQuery> ch;
+};
+
+// dist(s, t); fills path (if given) with the s -> t nodes
+using ServerKernel = function<double(int s, int t, Worker& w, vector<int>* path)>;
+
+// Read-only state shared by all workers
+struct Engine {
+    string input, nodes;
+    CSRGraph32 G, R;
+    bool directed = false;
+    ComponentIndex components;
+    shared_ptr<const LandmarkTable> landmarks;
+    unique_ptr<GeoModel> geo;
+    unique_ptr<ContractionHierarchy> ch;
+    unique_ptr<HubLabels> hl;
+    vector<ServerKernel> kernels;  // by algorithm id, empty if not served
+    size_t index_bytes = 0;        // graph + preprocessing, as loaded
+};
+
+// Prepares one algorithm (and whatever it needs) for serving
+void prepare(Engine& E, const string& algorithm)
+{
+    int id = algorithm_id(algorithm);
+    if (id < 0)
+        throw runtime_error("unknown algorithm " + algorithm);
+    const CSRGraph32& G = E.G;
+    auto workspace_path = [](Worker& w, int t, vector<int>* path) {
+        if (path)
+            *path = w.ws.path(t);
+    };
+    ServerKernel kernel;
+    if (algorithm == "dijk_lazy") {
+        kernel = [&G, workspace_path](int s, int t, Worker& w, vector<int>* path) {
+            double d = dijkstra_lazy(G, s, t, w.ws);
+            workspace_path(w, t, path);
+            return d;
+        };
+    } else if (algorithm == "dijk_decKey") {
+        kernel = [&G, workspace_path](int s, int t, Worker& w, vector<int>* path) {
+            double d = dijkstra_dary(G, s, t, w.ws);
+            workspace_path(w, t, path);
+            return d;
+        };
+    } else if (algorithm == "dijk_bidir") {
+        if (E.R.size() == 0) {
+            E.R = E.directed ? reverse_graph(G) : G;
+            E.index_bytes += E.directed ? E.R.num_edges() * sizeof(CSRGraph32::EdgeT) : 0;
+        }
+        const CSRGraph32& R = E.R;
+        kernel = [&G, &R, workspace_path](int s, int t, Worker& w, vector<int>* path) {
+            double d = dijkstra_bidir(G, R, s, t, w.ws, w.bwd);
+            workspace_path(w, t, path);
+            return d;
+        };
+    } else if (algorithm == "astar_alt") {
+        LandmarkTables T = landmark_tables(G, E.directed, LANDMARKS, landmark_cache_path(E.input, LANDMARKS));
+        E.landmarks = make_shared<const LandmarkTable>(T.dist_from_L, T.dist_to_L);
+        E.index_bytes += (T.dist_from_L.size() + T.dist_to_L.size()) * G.size() * sizeof(float);
+        auto table = E.landmarks;
+        kernel = [&G, table, workspace_path](int s, int t, Worker& w, vector<int>* path) {
+            MultiALT h(table, t);
+            h.active_count = 4;  // as in batch_query
+            h.refresh_interval = 100;
+            double d = astar_best(G, s, t, h, w.ws);
+            workspace_path(w, t, path);
+            return d;
+        };
+    } else if (algorithm == "astar_weighted") {
+        vector<LatLon> coords = open_coords(E.input, E.nodes, G.size());
+        if (!coords.empty()) {
+            E.index_bytes += coords.size() * sizeof(LatLon);
+            E.geo = make_unique<GeoModel>(G, move(coords));
+        }
+        const GeoModel* geo = E.geo.get();
+        kernel = [&G, geo, workspace_path](int s, int t, Worker& w, vector<int>* path) {
+            auto h = [geo, t](int v) { return geo ? geo->bound(v, t) : 0.0; };
+            double d = astar_weighted(G, s, t, h, 1.5, w.ws); // w = 1.5
+            workspace_path(w, t, path);
+            return d;
+        };
+    } else if (algorithm == "ch") {
+        E.ch = make_unique<ContractionHierarchy>(open_ch(G, E.input));
+        E.index_bytes += (E.ch->up.size() + E.ch->down.size()) * sizeof(CHEdge);
+        const ContractionHierarchy* H = E.ch.get();
+        kernel = [H](int s, int t, Worker& w, vector<int>* path) {
+            if (!w.ch)
+                w.ch = make_unique<CHQuery>(*H);
+            double d = w.ch->distance(s, t);
+            if (path)
+                *path = w.ch->path();
+            return d;
+        };
+    } else if (algorithm == "hl") {
+        E.hl = make_unique<HubLabels>(open_hub_labels(G, E.input, E.directed));
+        E.index_bytes += E.hl->memory_bytes();
+        const HubLabels* L = E.hl.get();
+        kernel = [&G, L, workspace_path](int s, int t, Worker& w, vector<int>* path) {
+            if (!path)
+                return L->distance(s, t);
+            double d = hub_label_search(G, *L, s, t, w.ws);  // paths need the label-guided search
+            workspace_path(w, t, path);
+            return d;
+        };
+    }
+    E.kernels[id] = kernel;
+}
+
+// Resident set size in bytes (0 where it is not available)
+size_t resident_bytes()
+{
+#ifdef __linux__
+    ifstream statm("/proc/self/statm");
+    size_t pages = 0, resident = 0;
+    if (statm >> pages >> resident)
+        return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    return 0;
+}
+
+// Latency counts in power-of-two microsecond buckets: bucket 0 is < 1 us, bucket i is [2^(i-1), 2^i)
+class LatencyHistogram {
+public:
+    static const int BUCKETS = 32;
+
+    void record(double seconds) {
+        double us = seconds * 1e6;
+        int b = us < 1 ? 0 : min(BUCKETS - 1, 1 + static_cast<int>(log2(us)));
+        counts[b].fetch_add(1, memory_order_relaxed);
+    }
+
+    vector<uint64_t> snapshot() const {
+        vector<uint64_t> out(BUCKETS);
+        for (int b = 0; b < BUCKETS; ++b)
+            out[b] = counts[b].load(memory_order_relaxed);
+        return out;
+    }
+
+    // Upper edge (us) of the bucket holding the q-quantile
+    static double quantile(const vector<uint64_t>& counts, double q) {
+        uint64_t total = accumulate(counts.begin(), counts.end(), uint64_t(0)), seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += counts[b];
+            if (total > 0 && seen >= q * total)
+                return ldexp(1.0, b);
+        }
+        return 0;
+    }
+
+private:
+    atomic<uint64_t> counts[BUCKETS] = {};
+};
+
+// One client: the fds it reads requests from and writes responses to (the same socket, or stdin/stdout)
+struct Connection {
+    int in_fd, out_fd;
+    bool owned;  // a socket, closed with the connection
+    mutex write_mutex;
+
+    Connection(int in_fd, int out_fd, bool owned) : in_fd(in_fd), out_fd(out_fd), owned(owned) {}
+    ~Connection() {
+        if (owned)
+            close_fd(in_fd);
+    }
+
+    bool send(const string& frames) {
+        lock_guard<mutex> lock(write_mutex);
+        return write_all(out_fd, frames.data(), frames.size());
+    }
+};
+
+class RoutingServer {
+public:
+    RoutingServer(const Engine& E, int threads, size_t max_batch) : E(E), max_batch(max(size_t(1), max_batch)) {
+        start = last_stats = chrono::steady_clock::now();
+        for (int tid = 0; tid < max(1, threads); ++tid)
+            workers.emplace_back([this] { work(); });
+    }
+
+    ~RoutingServer() { stop(); }
+
+    // Reads requests from conn until its stream ends or a Shutdown arrives; queries go to the workers
+    void serve(const shared_ptr<Connection>& conn) {
+        string payload;
+        while (!shutdown_requested() && read_frame(conn->in_fd, payload)) {
+            RouteRequest req;
+            if (!decode(payload, req)) {
+                // Echo op and id when the frame got that far, so the client can match the error
+                RouteResponse bad;
+                bad.op = req.op;
+                bad.id = req.id;
+                bad.status = Status::BadRequest;
+                errors.fetch_add(1, memory_order_relaxed);
+                conn->send(frame(bad));
+                continue;
+            }
+            if (req.op == Op::Query) {
+                {
+                    lock_guard<mutex> lock(queue_mutex);
+                    queue.push_back({req, conn, chrono::steady_clock::now()});
+                }
+                queue_ready.notify_one();
+                continue;
+            }
+            RouteResponse resp;
+            resp.op = req.op;
+            resp.id = req.id;
+            if (req.op == Op::Stats)
+                resp.text = stats();
+            conn->send(frame(resp));
+            if (req.op == Op::Shutdown) {
+                shutting_down = true;
+                if (on_shutdown)
+                    on_shutdown();
+            }
+        }
+    }
+
+    // Answers everything still queued, then stops the workers
+    void stop() {
+        {
+            lock_guard<mutex> lock(queue_mutex);
+            closing = true;
+        }
+        queue_ready.notify_all();
+        for (thread& th : workers)
+            if (th.joinable())
+                th.join();
+    }
+
+    bool shutdown_requested() const { return shutting_down; }
+
+    function<void()> on_shutdown;  // called by the reader that receives Shutdown
+
+    // "key value" lines: load, throughput, latency (arrival to response) and memory
+    string stats() {
+        auto now = chrono::steady_clock::now();
+        uint64_t done = answered.load(memory_order_relaxed);
+        double uptime = chrono::duration<double>(now - start).count();
+        double recent_qps;
+        {
+            lock_guard<mutex> lock(stats_mutex);
+            double window = chrono::duration<double>(now - last_stats).count();
+            recent_qps = window > 0 ? (done - last_answered) / window : 0;
+            last_stats = now;
+            last_answered = done;
+        }
+        size_t queued;
+        {
+            lock_guard<mutex> lock(queue_mutex);
+            queued = queue.size();
+        }
+        vector<uint64_t> hist = latency.snapshot();
+        uint64_t batch_count = batches.load(memory_order_relaxed);
+
+        ostringstream out;
+        out << fixed << setprecision(1);
+        out << "nodes " << E.G.size() << "\n";
+        out << "arcs " << E.G.num_edges() << "\n";
+        out << "algorithms";
+        for (size_t id = 0; id < ALGORITHMS.size(); ++id)
+            if (E.kernels[id])
+                out << " " << ALGORITHMS[id];
+        out << "\n";
+        out << "workers " << workers.size() << "\n";
+        out << "uptime_s " << uptime << "\n";
+        out << "queries " << done << "\n";
+        out << "errors " << errors.load(memory_order_relaxed) << "\n";
+        out << "queued " << queued << "\n";
+        out << "qps " << (uptime > 0 ? done / uptime : 0) << "\n";
+        out << "qps_since_last_stats " << recent_qps << "\n";
+        out << "batches " << batch_count << "\n";
+        out << "mean_batch " << (batch_count ? double(done) / batch_count : 0) << "\n";
+        out << "latency_p50_us " << LatencyHistogram::quantile(hist, 0.50) << "\n";
+        out << "latency_p90_us " << LatencyHistogram::quantile(hist, 0.90) << "\n";
+        out << "latency_p99_us " << LatencyHistogram::quantile(hist, 0.99) << "\n";
+        out << "latency_histogram_us";
+        for (int b = 0; b < LatencyHistogram::BUCKETS; ++b)
+            if (hist[b])
+                out << " <" << static_cast<uint64_t>(ldexp(1.0, b)) << ":" << hist[b];
+        out << "\n";
+        out << "index_mb " << E.index_bytes / 1e6 << "\n";
+        out << "rss_mb " << resident_bytes() / 1e6 << "\n";
+        return out.str();
+    }
+
+private:
+    struct Job {
+        RouteRequest req;
+        shared_ptr<Connection> conn;
+        chrono::steady_clock::time_point arrival;
+    };
+
+    const Engine& E;
+    size_t max_batch;
+    vector<thread> workers;
+    mutex queue_mutex;
+    condition_variable queue_ready;
+    deque<Job> queue;
+    bool closing = false;
+    atomic<bool> shutting_down{false};
+
+    chrono::steady_clock::time_point start;
+    mutex stats_mutex;
+    chrono::steady_clock::time_point last_stats;
+    uint64_t last_answered = 0;
+    atomic<uint64_t> answered{0}, errors{0}, batches{0};
+    LatencyHistogram latency;
+
+    static string frame(const RouteResponse& resp) {
+        string out;
+        append_frame(out, encode(resp));
+        return out;
+    }
+
+    RouteResponse answer(const RouteRequest& req, Worker& w) {
+        RouteResponse resp;
+        resp.id = req.id;
+        int n = E.G.size();
+        if (req.s < 0 || req.s >= n || req.t < 0 || req.t >= n || req.algorithm >= ALGORITHMS.size()) {
+            resp.status = Status::BadRequest;
+            return resp;
+        }
+        const ServerKernel& kernel = E.kernels[req.algorithm];
+        if (!kernel) {
+            resp.status = Status::Unsupported;
+            return resp;
+        }
+        auto t0 = chrono::steady_clock::now();
+        vector<int> path;
+        if (E.components.may_reach(req.s, req.t))
+            resp.dist = kernel(req.s, req.t, w, (req.flags & WANT_PATH) ? &path : nullptr);
+        resp.server_us = static_cast<float>(chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count());
+        if (resp.dist != INF)
+            resp.path.assign(path.begin(), path.end());
+        return resp;
+    }
+
+    void work() {
+        Worker w;
+        w.ws.begin(E.G.size());  // allocate once, before the first request
+        w.bwd.begin(E.G.size());
+        vector<Job> batch;
+        vector<pair<Connection*, string>> out;
+        while (true) {
+            batch.clear();
+            {
+                unique_lock<mutex> lock(queue_mutex);
+                queue_ready.wait(lock, [this] { return !queue.empty() || closing; });
+                if (queue.empty())
+                    return;
+                while (!queue.empty() && batch.size() < max_batch) {
+                    batch.push_back(move(queue.front()));
+                    queue.pop_front();
+                }
+            }
+            batches.fetch_add(1, memory_order_relaxed);
+
+            // Responses are grouped per connection and written with one call each
+            out.clear();
+            for (const Job& job : batch) {
+                RouteResponse resp = answer(job.req, w);
+                if (resp.status != Status::Ok)
+                    errors.fetch_add(1, memory_order_relaxed);
+                auto it = find_if(out.begin(), out.end(), [&](const auto& o) { return o.first == job.conn.get(); });
+                if (it == out.end())
+                    it = out.emplace(out.end(), job.conn.get(), string());
+                append_frame(it->second, encode(resp));
+                latency.record(chrono::duration<double>(chrono::steady_clock::now() - job.arrival).count());
+            }
+            for (auto& [conn, frames] : out)
+                conn->send(frames);  // a client that went away just loses its answers
+            answered.fetch_add(batch.size(), memory_order_relaxed);
+        }
+    }
+};
+
+vector<string> split_list(const string& list)
+{
+    vector<string> items;
+    string item;
+    istringstream in(list);
+    while (getline(in, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return items;
+}
+
+int main(int argc, char** argv)
+{
+    string dataset = "large", socket_path = DEFAULT_SOCKET;
+    vector<string> algorithms = {"dijk_lazy", "dijk_bidir", "astar_alt", "ch"};
+    bool use_stdin = false;
+    int threads = default_threads();
+    size_t max_batch = 32;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--stdin")
+            use_stdin = true;
+        else if (arg == "--dataset" && has_value)
+            dataset = argv[++i];
+        else if (arg == "--socket" && has_value)
+            socket_path = argv[++i];
+        else if (arg == "--threads" && has_value)
+            threads = stoi(argv[++i]);
+        else if (arg == "--batch" && has_value)
+            max_batch = stoul(argv[++i]);
+        else if (arg == "--algorithms" && has_value) {
+            string list = argv[++i];
+            algorithms = list == "all" ? ALGORITHMS : split_list(list);
+        }
+        else {
+            cerr << "usage: routing_server [--dataset large] [--socket PATH | --stdin] [--threads N] [--batch B]"
+                    " [--algorithms a,b,... | all]\n";
+            return 2;
+        }
+    }
+
+    Engine E;
+    E.input = "../input_edges/graph_" + dataset + "_edges.txt";
+    E.nodes = "../map_data/graph_" + dataset + "_nodes.txt";
+    if (!ifstream(E.input)) {
+        cerr << E.input << " not found\n";
+        return 1;
+    }
+    auto load_start = chrono::steady_clock::now();
+    try {
+        E.G = open_graph(E.input);  // binary if convert_graph was run
+        E.directed = read_graph_header(E.input).directed;
+        E.components = open_components(E.input, E.G, E.directed);
+        E.index_bytes = E.G.num_edges() * sizeof(CSRGraph32::EdgeT) + (E.G.size() + 1) * sizeof(uint32_t);
+        E.kernels.resize(ALGORITHMS.size());
+        for (const string& a : algorithms)
+            prepare(E, a);
+    } catch (const exception& e) {
+        cerr << e.what() << "\n";
+        return 1;
+    }
+    cerr << "Loaded " << dataset << " (" << E.G.size() << " nodes, " << E.G.num_edges() << " arcs) and";
+    for (const string& a : algorithms)
+        cerr << " " << a;
+    cerr << " in " << chrono::duration<double>(chrono::steady_clock::now() - load_start).count() << " seconds\n";
+
+    RoutingServer server(E, threads, max_batch);
+    if (use_stdin) {
+        binary_stdio();
+        cerr << "Serving stdin with " << threads << " workers\n";
+        server.serve(make_shared<Connection>(0, 1, false));
+    } else {
+        ignore_sigpipe();
+        int listen_fd;
+        try {
+            listen_fd = listen_unix(socket_path);
+        } catch (const exception& e) {
+            cerr << e.what() << "\n";
+            return 1;
+        }
+        cerr << "Serving " << socket_path << " with " << threads << " workers\n";
+
+        // Readers are detached, one per connection; live counts them so shutdown can wait for the last
+        mutex clients_mutex;
+        condition_variable readers_done;
+        vector<weak_ptr<Connection>> clients;
+        int live = 0;
+        server.on_shutdown = [listen_fd] { shutdown_fd(listen_fd); };
+        while (true) {
+            int fd = accept_connection(listen_fd);
+            if (fd < 0 || server.shutdown_requested()) {
+                if (fd >= 0)
+                    close_fd(fd);
+                break;
+            }
+            auto conn = make_shared<Connection>(fd, fd, true);
+            {
+                lock_guard<mutex> lock(clients_mutex);
+                // Connections that closed since the last accept are dropped from the list
+                clients.erase(remove_if(clients.begin(), clients.end(),
+                                        [](const weak_ptr<Connection>& c) { return c.expired(); }),
+                              clients.end());
+                clients.push_back(conn);
+                ++live;
+            }
+            thread([&, conn]() mutable {
+                server.serve(conn);
+                conn.reset();  // queued answers keep it open until they are written
+                lock_guard<mutex> lock(clients_mutex);
+                if (--live == 0)
+                    readers_done.notify_all();
+            }).detach();
+        }
+        // Stop reading from the clients still connected (they stay writable) and wait for the readers;
+        // server.stop() below answers everything queued before the last references close the sockets
+        {
+            unique_lock<mutex> lock(clients_mutex);
+            for (auto& c : clients)
+                if (auto conn = c.lock())
+                    shutdown_read(conn->in_fd);
+            readers_done.wait(lock, [&] { return live == 0; });
+        }
+        close_fd(listen_fd);
+        remove(socket_path.c_str());
+    }
+    server.stop();
+    cerr << "Shutting down\n" << server.stats();
+}
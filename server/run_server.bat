@@ -0,0 +1,31 @@
+@echo off
+echo ==============================
+echo Compiling Routing Server
+echo ==============================
+
+REM Create build folder if not existing
+if not exist ..\build mkdir ..\build
+
+echo [1/3] Compiling routing_server...
+g++ -std=c++17 -O2 -I..\helpers routing_server.cpp ..\helpers\timer.cpp -o ..\build\routing_server.exe
+
+echo [2/3] Compiling route_client...
+g++ -std=c++17 -O2 -I..\helpers route_client.cpp ..\helpers\timer.cpp -o ..\build\route_client.exe
+
+echo [3/3] Compiling load_gen...
+g++ -std=c++17 -O2 -I..\helpers load_gen.cpp ..\helpers\timer.cpp -o ..\build\load_gen.exe
+
+echo ==============================
+echo Running Routing Server
+echo ==============================
+
+REM Unix sockets are not available in Windows builds, so the demo pipes the batch_query
+REM query file through one server process; elsewhere run routing_server, then
+REM route_client or load_gen against its socket
+echo Running routing_server over a pipe...
+..\build\route_client.exe --encode ch ..\input_edges\graph_large_queries.txt | ..\build\routing_server.exe --stdin --algorithms ch | ..\build\route_client.exe --decode
+
+echo ==============================
+echo ✅ Routing server demo completed.
+echo ==============================
+pause